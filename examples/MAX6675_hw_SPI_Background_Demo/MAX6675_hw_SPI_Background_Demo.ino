@@ -0,0 +1,149 @@
+/***************************************************************************************************/
+/* 
+   Example for 12-bit MAX6675 K-Thermocouple to Digital Converter with Cold Junction Compensation
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep k-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny Core           - https://github.com/SpenceKonde/ATTinyCore
+   ESP32 Core            - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32 Core            - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+
+   NOTE:
+   - on AVR uncomment MAX6675_BACKGROUND_AVR_TIMER0 in MAX6675Background.h
+   - on STM32 uncomment MAX6675_BACKGROUND_STM32_TIMER in MAX6675Background.h
+*/
+/***************************************************************************************************/
+#include <SPI.h>
+#include <MAX6675.h>
+#include <MAX6675Bank.h>
+#include <MAX6675Background.h>
+#include <MAX6675RingBuffer.h>
+
+#if defined(ESP8266)
+#include <ESP8266WiFi.h>
+#endif
+
+
+volatile uint32_t sampleQnt = 0;
+
+MAX6675Sample     ringStorage[16];                          //statically allocated, 16 samples ~3.5sec for 2 sensors
+MAX6675Sample     samples[4];
+
+/*
+MAX6675(cs)
+
+cs  - chip select
+*/
+
+MAX6675           myMAX6675_01(4); //for ESP8266 change to D4 (fails to BOOT/FLASH if pin LOW)
+MAX6675           myMAX6675_02(5); //for ESP8266 change to D3 (fails to BOOT/FLASH if pin LOW)
+
+MAX6675Bank       myBank;
+MAX6675Background myBackground(myBank);
+MAX6675RingBuffer myRingBuffer(ringStorage, 16);
+
+
+/* called from timer interrupt/task or from service(), keep it short */
+void onSample(uint8_t channel, uint16_t rawValue)
+{
+  (void)channel;
+  (void)rawValue;
+
+  sampleQnt++;
+}
+
+void setup()
+{
+  #if defined(ESP8266)
+  WiFi.persistent(false); //disable saving wifi config into SDK flash area
+  WiFi.forceSleepBegin(); //disable swAP & station by calling "WiFi.mode(WIFI_OFF)" & put modem to sleep
+  #endif
+
+  Serial.begin(115200);
+
+  /* start MAX6675 */
+  myMAX6675_01.begin();
+  myMAX6675_02.begin();
+
+  myBank.addSensor(myMAX6675_01);  //channel 0
+  myBank.addSensor(myMAX6675_02);  //channel 1
+
+  myBackground.setRingBuffer(myRingBuffer);
+
+  while (myBackground.begin(onSample) != true)
+  {
+    Serial.println(F("No built-in timer, see MAX6675Background.h")); //(F()) saves string to flash & keeps dynamic memory free
+    delay(5000);
+  }
+  Serial.println(F("Background acquisition started"));
+}
+
+void loop()
+{
+  /* reads the sensors on ESP32 & STM32 if timer requested it, does nothing on other boards */
+  myBackground.service();
+
+  if (myBackground.available() == true)
+  {
+    for (uint8_t channel = 0; channel < myBank.getSensorQnt(); channel++)
+    {
+      float temperature = MAX6675::decodeTemperature(myBackground.getRawData(channel)); //decode only, never reads the sensor
+
+      Serial.print(F("Temperature_0"));
+      Serial.print(channel + 1);
+      Serial.print(F(": "));
+      if (temperature != MAX6675_ERROR) Serial.println(temperature, 1);
+      else                              Serial.println(F("xx"));      //thermocouple broken, unplugged or 'T-' terminal is not grounded
+    }
+
+    Serial.print(F("Samples: "));
+    Serial.println(sampleQnt);
+  }
+
+  /* drain ring buffer in bulk, no sample is lost if loop() was busy */
+  max6675_index_t sampleQntInBlock = myRingBuffer.read(samples, 4);
+
+  for (max6675_index_t i = 0; i < sampleQntInBlock; i++)
+  {
+    Serial.print(samples[i].timestamp);
+    Serial.print(F("us, channel "));
+    Serial.print(samples[i].channel);
+    Serial.print(F(", raw 0x"));
+    Serial.println(samples[i].rawValue, HEX);
+  }
+
+  if (myRingBuffer.getOverflowQnt() != 0)
+  {
+    Serial.print(F("Dropped samples: "));
+    Serial.println(myRingBuffer.getOverflowQnt());
+  }
+}
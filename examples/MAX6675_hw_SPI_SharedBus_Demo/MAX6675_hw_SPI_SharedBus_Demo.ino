@@ -0,0 +1,95 @@
+/***************************************************************************************************/
+/* 
+   Example for 12-bit MAX6675 K-Thermocouple to Digital Converter with Cold Junction Compensation
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep k-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny Core           - https://github.com/SpenceKonde/ATTinyCore
+   ESP32 Core            - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32 Core            - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <SPI.h>
+#include <MAX6675.h>
+#include <MAX6675SPIBus.h>
+
+
+/*
+MAX6675(cs)
+
+cs  - chip select
+*/
+
+MAX6675       myMAX6675_01(4); //for ESP8266 change to D4 (fails to BOOT/FLASH if pin LOW)
+MAX6675       myMAX6675_02(5); //for ESP8266 change to D3 (fails to BOOT/FLASH if pin LOW)
+
+MAX6675SPIBus myBus;
+
+#define OTHER_DEVICE_TIME 5000 //in microseconds, longest SPI transaction of SD card/display on the same bus
+
+
+void setup()
+{
+  Serial.begin(115200);
+
+  /* start MAX6675 */
+  myMAX6675_01.begin();
+  myMAX6675_02.begin();
+
+  myBus.addSensor(myMAX6675_01);  //channel 0
+  myBus.addSensor(myMAX6675_02);  //channel 1
+}
+
+void loop()
+{
+  /* never blocks, reads all ready sensors in one SPI transaction */
+  uint8_t readyMask = myBus.service();
+
+  for (uint8_t channel = 0; channel < myBus.getSensorQnt(); channel++)
+  {
+    if (bitRead(readyMask, channel) == 0) continue;
+
+    MAX6675Reading reading = myBus.getReading(channel);
+
+    Serial.print(F("Temperature_0"));
+    Serial.print(channel + 1);
+    Serial.print(F(": "));
+    if ((reading.idValid == true) && (reading.thermocoupleOpen != true)) Serial.println((float)reading.temperature * MAX6675_RESOLUTION, 2);
+    else                                                                 Serial.println(F("xx")); //thermocouple broken, unplugged or 'T-' terminal is not grounded
+  }
+
+  /* other devices use the bus only if it doesn't delay next thermocouple read */
+  if (myBus.timeToNextRead() > OTHER_DEVICE_TIME)
+  {
+    //SD card write, display update, etc.
+  }
+}
@@ -76,6 +76,8 @@ void setup()
     delay(5000);
   }
   Serial.println(F("MAX6675 OK"));
+
+  myMAX6675.setFreeRunning(true);       //loop() reads every second, so the result of last conversion is always ready & no wait is needed
 }
 
 void loop()
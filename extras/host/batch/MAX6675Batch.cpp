@@ -0,0 +1,210 @@
+/***************************************************************************************************/
+/*
+   Host batch decoder of raw MAX6675 data words, see MAX6675Batch.h
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX6675Batch.h>
+
+#ifdef MAX6675_BATCH_X86
+#include <immintrin.h>
+#endif
+
+
+/**************************************************************************/
+/*
+    decode()
+
+    Decodes qnt. raw words with the fastest kernel for this CPU
+
+    NOTE:
+    - kernel is selected once on the first call
+    - output arrays must hold qnt. elements, no alignment is required
+*/
+/**************************************************************************/
+void MAX6675BatchDecoder::decode(const uint16_t *rawValue, size_t qnt, float *temperature, uint8_t *thermocoupleOpen, uint8_t *idValid)
+{
+  static const Kernel kernel = _selectKernel();
+
+  kernel(rawValue, qnt, temperature, thermocoupleOpen, idValid);
+}
+
+/**************************************************************************/
+/*
+    getKernelName()
+
+    Returns name of the kernel used by decode()
+*/
+/**************************************************************************/
+const char *MAX6675BatchDecoder::getKernelName(void)
+{
+  Kernel kernel = _selectKernel();
+
+  #ifdef MAX6675_BATCH_X86
+  if (kernel == &decodeAVX2) return "AVX2";
+  if (kernel == &decodeSSE2) return "SSE2";
+  #endif
+
+  (void)kernel;
+
+  return "scalar";
+}
+
+/**************************************************************************/
+/*
+    decodeScalar()
+
+    Decodes one word at a time, same bit logic as MAX6675::decodeRawData()
+
+    NOTE:
+    - bits D14..D3 temperature in quarter-degrees
+    - bit D2 is high if thermocouple is open
+    - bit D1 is low if chip is connected
+*/
+/**************************************************************************/
+void MAX6675BatchDecoder::decodeScalar(const uint16_t *rawValue, size_t qnt, float *temperature, uint8_t *thermocoupleOpen, uint8_t *idValid)
+{
+  for (size_t i = 0; i < qnt; i++)
+  {
+    uint16_t raw = rawValue[i];
+
+    thermocoupleOpen[i] = (raw >> 2) & 0x01;
+    idValid[i]          = ((raw >> 1) & 0x01) ^ 0x01;
+    temperature[i]      = ((raw & 0x0006) == 0) ? (float)((raw >> 3) & 0x0FFF) * 0.25f : MAX6675_BATCH_ERROR;
+  }
+}
+
+#ifdef MAX6675_BATCH_X86
+/**************************************************************************/
+/*
+    decodeSSE2()
+
+    Decodes 8 words per iteration
+
+    NOTE:
+    - bits are extracted in 16-bit lanes, temperature is widened to 2x4
+      32-bit lanes & converted to float, flags are packed to bytes
+    - SSE2 has no blend, error value is selected with and/andnot/or
+*/
+/**************************************************************************/
+__attribute__((target("sse2")))
+void MAX6675BatchDecoder::decodeSSE2(const uint16_t *rawValue, size_t qnt, float *temperature, uint8_t *thermocoupleOpen, uint8_t *idValid)
+{
+  const __m128i one   = _mm_set1_epi16(0x0001);
+  const __m128i code  = _mm_set1_epi16(0x0FFF);
+  const __m128i flags = _mm_set1_epi16(0x0006);
+  const __m128i zero  = _mm_setzero_si128();
+  const __m128  scale = _mm_set1_ps(0.25f);
+  const __m128  error = _mm_set1_ps(MAX6675_BATCH_ERROR);
+  size_t        i     = 0;
+
+  for (; (i + 8) <= qnt; i += 8)
+  {
+    __m128i raw   = _mm_loadu_si128((const __m128i *)(rawValue + i));
+    __m128i value = _mm_and_si128(_mm_srli_epi16(raw, 3), code);
+    __m128i open  = _mm_and_si128(_mm_srli_epi16(raw, 2), one);
+    __m128i id    = _mm_xor_si128(_mm_and_si128(_mm_srli_epi16(raw, 1), one), one);
+    __m128i valid = _mm_cmpeq_epi16(_mm_and_si128(raw, flags), zero);                //all ones if D2 & D1 are low
+
+    __m128  low       = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(value, zero)), scale);
+    __m128  high      = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(value, zero)), scale);
+    __m128  validLow  = _mm_castsi128_ps(_mm_unpacklo_epi16(valid, valid));          //16-bit mask to 32-bit mask
+    __m128  validHigh = _mm_castsi128_ps(_mm_unpackhi_epi16(valid, valid));
+
+    low  = _mm_or_ps(_mm_and_ps(validLow,  low),  _mm_andnot_ps(validLow,  error));
+    high = _mm_or_ps(_mm_and_ps(validHigh, high), _mm_andnot_ps(validHigh, error));
+
+    _mm_storeu_ps(temperature + i,     low);
+    _mm_storeu_ps(temperature + i + 4, high);
+
+    _mm_storel_epi64((__m128i *)(thermocoupleOpen + i), _mm_packus_epi16(open, zero));
+    _mm_storel_epi64((__m128i *)(idValid + i),          _mm_packus_epi16(id,   zero));
+  }
+
+  decodeScalar(rawValue + i, qnt - i, temperature + i, thermocoupleOpen + i, idValid + i);
+}
+
+/**************************************************************************/
+/*
+    decodeAVX2()
+
+    Decodes 16 words per iteration
+
+    NOTE:
+    - same as decodeSSE2(), but 16-bit lanes are widened with vpmovzxwd
+      & error value is selected with vblendvps
+    - AVX2 pack works inside 128-bit lanes, so flags are packed from
+      two 128-bit halves to keep the order
+*/
+/**************************************************************************/
+__attribute__((target("avx2")))
+void MAX6675BatchDecoder::decodeAVX2(const uint16_t *rawValue, size_t qnt, float *temperature, uint8_t *thermocoupleOpen, uint8_t *idValid)
+{
+  const __m256i one   = _mm256_set1_epi16(0x0001);
+  const __m256i code  = _mm256_set1_epi16(0x0FFF);
+  const __m256i flags = _mm256_set1_epi16(0x0006);
+  const __m256i zero  = _mm256_setzero_si256();
+  const __m256  scale = _mm256_set1_ps(0.25f);
+  const __m256  error = _mm256_set1_ps(MAX6675_BATCH_ERROR);
+  size_t        i     = 0;
+
+  for (; (i + 16) <= qnt; i += 16)
+  {
+    __m256i raw   = _mm256_loadu_si256((const __m256i *)(rawValue + i));
+    __m256i value = _mm256_and_si256(_mm256_srli_epi16(raw, 3), code);
+    __m256i open  = _mm256_and_si256(_mm256_srli_epi16(raw, 2), one);
+    __m256i id    = _mm256_xor_si256(_mm256_and_si256(_mm256_srli_epi16(raw, 1), one), one);
+    __m256i valid = _mm256_cmpeq_epi16(_mm256_and_si256(raw, flags), zero);
+
+    __m256  low       = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(value))),      scale);
+    __m256  high      = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(value, 1))), scale);
+    __m256  validLow  = _mm256_castsi256_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(valid)));              //sign extension keeps all ones
+    __m256  validHigh = _mm256_castsi256_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(valid, 1)));
+
+    _mm256_storeu_ps(temperature + i,     _mm256_blendv_ps(error, low,  validLow));
+    _mm256_storeu_ps(temperature + i + 8, _mm256_blendv_ps(error, high, validHigh));
+
+    _mm_storeu_si128((__m128i *)(thermocoupleOpen + i), _mm_packus_epi16(_mm256_castsi256_si128(open), _mm256_extracti128_si256(open, 1)));
+    _mm_storeu_si128((__m128i *)(idValid + i),          _mm_packus_epi16(_mm256_castsi256_si128(id),   _mm256_extracti128_si256(id,   1)));
+  }
+
+  decodeSSE2(rawValue + i, qnt - i, temperature + i, thermocoupleOpen + i, idValid + i);
+}
+
+/**************************************************************************/
+/*
+    hasAVX2()
+
+    Returns true if CPU & OS support AVX2
+*/
+/**************************************************************************/
+bool MAX6675BatchDecoder::hasAVX2(void)
+{
+  __builtin_cpu_init();
+
+  return __builtin_cpu_supports("avx2");
+}
+#endif
+
+/**************************************************************************/
+/*
+    _selectKernel()
+
+    Returns the fastest kernel for this CPU, SSE2 is baseline of x86-64
+*/
+/**************************************************************************/
+MAX6675BatchDecoder::Kernel MAX6675BatchDecoder::_selectKernel(void)
+{
+  #ifdef MAX6675_BATCH_X86
+  if (hasAVX2() == true) return &decodeAVX2;
+
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("sse2")) return &decodeSSE2;
+  #endif
+
+  return &decodeScalar;
+}
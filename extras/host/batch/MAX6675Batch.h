@@ -0,0 +1,50 @@
+/***************************************************************************************************/
+/*
+   Host batch decoder of raw MAX6675 data words, see MAX6675::readRawData()
+
+   - decodes array of raw words into structure of arrays: temperature, thermocouple open
+     & chip ID valid, same results as MAX6675::getTemperature(), detectThermocouple()
+     & getChipID() for every word
+   - temperature is MAX6675_BATCH_ERROR if thermocouple is open or chip ID is wrong
+   - SSE2 & AVX2 kernels on x86, best one is selected at run time, scalar kernel on
+     other CPUs & for the tail of the array
+   - no Arduino core is needed, links into any Linux program
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675Batch_h
+#define MAX6675Batch_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MAX6675_BATCH_ERROR 2000.0f          //same as MAX6675_ERROR
+
+#if defined(__x86_64__) || defined(__i386__)
+#define MAX6675_BATCH_X86
+#endif
+
+
+class MAX6675BatchDecoder
+{
+  public:
+   typedef void (*Kernel)(const uint16_t *rawValue, size_t qnt, float *temperature, uint8_t *thermocoupleOpen, uint8_t *idValid);
+
+   static void        decode(const uint16_t *rawValue, size_t qnt, float *temperature, uint8_t *thermocoupleOpen, uint8_t *idValid);
+   static const char *getKernelName(void);
+
+   static void        decodeScalar(const uint16_t *rawValue, size_t qnt, float *temperature, uint8_t *thermocoupleOpen, uint8_t *idValid);
+   #ifdef MAX6675_BATCH_X86
+   static void        decodeSSE2(const uint16_t *rawValue, size_t qnt, float *temperature, uint8_t *thermocoupleOpen, uint8_t *idValid);
+   static void        decodeAVX2(const uint16_t *rawValue, size_t qnt, float *temperature, uint8_t *thermocoupleOpen, uint8_t *idValid);
+   static bool        hasAVX2(void);
+   #endif
+
+  private:
+   static Kernel      _selectKernel(void);
+};
+
+#endif
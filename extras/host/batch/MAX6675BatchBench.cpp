@@ -0,0 +1,131 @@
+/***************************************************************************************************/
+/*
+   Benchmark of MAX6675BatchDecoder kernels against per-word library calls
+
+   - 1M raw words, ~90% valid readings, ~5% open thermocouple, ~5% chip ID errors
+   - every kernel is checked against MAX6675::getTemperature(), detectThermocouple()
+     & getChipID() for every word
+   - ns/word & Mwords/s are the best of several passes, wall-clock time
+
+   build & run:
+   cmake -S . -B build && cmake --build build && ./build/max6675_batch_bench
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+
+#include <MAX6675.h>
+#include <MAX6675Batch.h>
+
+#define BATCH_WORDS  1000000
+#define BATCH_PASSES 20
+
+
+static std::vector<uint16_t> rawValue(BATCH_WORDS);
+static std::vector<float>    temperature(BATCH_WORDS);
+static std::vector<uint8_t>  thermocoupleOpen(BATCH_WORDS);
+static std::vector<uint8_t>  idValid(BATCH_WORDS);
+
+static std::vector<float>    expectedTemperature(BATCH_WORDS);
+static std::vector<uint8_t>  expectedOpen(BATCH_WORDS);
+static std::vector<uint8_t>  expectedID(BATCH_WORDS);
+
+
+/*
+   per-word decoding with the library, baseline & reference for all kernels
+*/
+static void decodeLibrary(const uint16_t *raw, size_t qnt, float *temp, uint8_t *open, uint8_t *id)
+{
+  MAX6675 sensor(0);                                                 //no bus access, raw data is passed to every call
+
+  for (size_t i = 0; i < qnt; i++)
+  {
+    temp[i] = sensor.getTemperature(raw[i]);
+    id[i]   = (sensor.getChipID(raw[i]) == MAX6675_ID);
+    open[i] = (id[i] == true) ? (sensor.detectThermocouple(raw[i]) != true) : MAX6675::decodeRawData(raw[i]).thermocoupleOpen; //detectThermocouple() is false on ID error too
+  }
+}
+
+static void bench(const char *name, MAX6675BatchDecoder::Kernel kernel, double baseline)
+{
+  double   best = 1e30;
+  uint32_t bad  = 0;
+
+  for (uint8_t pass = 0; pass < BATCH_PASSES; pass++)
+  {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    kernel(rawValue.data(), BATCH_WORDS, temperature.data(), thermocoupleOpen.data(), idValid.data());
+
+    double time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    if (time < best) best = time;
+  }
+
+  for (size_t i = 0; i < BATCH_WORDS; i++)
+  {
+    if ((temperature[i] != expectedTemperature[i]) || (thermocoupleOpen[i] != expectedOpen[i]) || (idValid[i] != expectedID[i])) bad++;
+  }
+
+  printf("%-28s %10.3f %12.1f %9.1fx %6u\n", name, best / BATCH_WORDS, BATCH_WORDS / best * 1e3, (baseline > 0) ? baseline / best : 1.0, bad);
+}
+
+static double benchLibrary(void)
+{
+  double best = 1e30;
+
+  for (uint8_t pass = 0; pass < BATCH_PASSES; pass++)
+  {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    decodeLibrary(rawValue.data(), BATCH_WORDS, expectedTemperature.data(), expectedOpen.data(), expectedID.data());
+
+    double time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    if (time < best) best = time;
+  }
+
+  printf("%-28s %10.3f %12.1f %9.1fx %6u\n", "MAX6675 per word", best / BATCH_WORDS, BATCH_WORDS / best * 1e3, 1.0, 0);
+
+  return best;
+}
+
+
+int main(void)
+{
+  srand(6675);
+
+  for (size_t i = 0; i < BATCH_WORDS; i++)
+  {
+    uint16_t raw = ((rand() % 4096) << 3) | (rand() & 0x01);        //D14..D3 temperature, D0 three-state
+    int      roll = rand() % 100;
+
+    if      (roll < 5)  raw |= 0x0004;                               //open thermocouple
+    else if (roll < 10) raw |= 0x0002;                               //chip ID error
+
+    rawValue[i] = raw;
+  }
+
+  printf("%-28s %10s %12s %10s %6s\n", "decoder", "ns/word", "Mwords/s", "speedup", "bad");
+
+  double baseline = benchLibrary();
+
+  bench("MAX6675BatchDecoder scalar", &MAX6675BatchDecoder::decodeScalar, baseline);
+
+  #ifdef MAX6675_BATCH_X86
+  bench("MAX6675BatchDecoder SSE2", &MAX6675BatchDecoder::decodeSSE2, baseline);
+
+  if (MAX6675BatchDecoder::hasAVX2() == true) bench("MAX6675BatchDecoder AVX2", &MAX6675BatchDecoder::decodeAVX2, baseline);
+  else                                        printf("%-28s not supported by this CPU\n", "MAX6675BatchDecoder AVX2");
+  #endif
+
+  printf("decode() uses %s\n", MAX6675BatchDecoder::getKernelName());
+
+  return 0;
+}
@@ -0,0 +1,695 @@
+/***************************************************************************************************/
+/*
+   Benchmark of MAX6675 library read paths on host against mock Arduino core & simulated
+   MAX6675, see extras/host/mock
+
+   - all times are virtual, costs of core calls are close to 5v-16MHz AVR
+   - samples/s    - samples per second per sensor
+   - bus us       - time CS was low per sample, in microseconds
+   - blocked ms   - time spent inside library calls per sample, in milliseconds
+   - toggles      - GPIO level changes per sample
+   - aborted      - conversions aborted by CS low before they were completed
+   - stale        - reads that got previous result because conversion was aborted
+   - bad          - samples that don't match simulated temperature
+
+   build & run:
+   cmake -S . -B build && cmake --build build && ./build/max6675_bench
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+
+#include <MAX6675.h>
+#include <MAX6675Soft.h>
+#include <MAX6675SoftFast.h>
+#include <MAX6675SoftParallel.h>
+#include <MAX6675Bank.h>
+#include <MAX6675Background.h>
+#include <MAX6675SPIBus.h>
+#include <MAX6675Scheduler.h>
+#include <MAX6675Log.h>
+#include <MAX6675Driver.h>
+#include <MAX6675Sim.h>
+#include <MAX6675MockTransport.h>
+#include <MAX6675LogDecoder.h>
+
+#define BENCH_DURATION    60000000000ULL                     //in nanoseconds, 60sec of virtual time per read path
+#define BENCH_LOOP_TIME   50000ULL                           //in nanoseconds, app work per loop() pass for non-blocking paths
+#define BENCH_SLOW_PERIOD 1000000000ULL                      //in nanoseconds, app reads every 1sec
+
+#define BENCH_MAX_SENSORS 4
+#define BENCH_DECODE_QNT  10000000UL                       //reads for wall-clock read + decode benchmark
+
+
+/*
+   per-instance counters, only if library is built with cmake -DMAX6675_ENABLE_STATS=ON
+*/
+static void printStats(MAX6675 &sensor)
+{
+  #ifdef MAX6675_ENABLE_STATS
+  MAX6675Stats stats;
+
+  sensor.getStats(stats);
+
+  printf("%-42s reads %u, open %u, id errors %u, stuck low/high %u/%u, wait %u us, bus %u us, irq off %u us, latency",
+         "  stats", stats.readQnt, stats.openQnt, stats.idErrorQnt, stats.stuckLowQnt, stats.stuckHighQnt, stats.waitTime, stats.busTime, stats.irqOffTime);
+
+  for (uint8_t i = 0; i < MAX6675_STATS_LATENCY_BUCKETS; i++) printf(" %u", stats.latency[i]);
+
+  printf("\n");
+  #else
+  (void)sensor;
+  #endif
+}
+
+
+class Bench
+{
+  public:
+   Bench(const char *name) : _name(name), _simQnt(0), _samples(0), _badSamples(0), _blockedTime(0), _enter(0)
+   {
+   }
+
+   void attach(MAX6675Sim &sim)
+   {
+     ArduinoMock::attach(sim);
+
+     _sim[_simQnt++] = &sim;
+   }
+
+   void start(void)
+   {
+     _start = ArduinoMock::now();
+     _stats = ArduinoMock::getStats();
+
+     for (uint8_t i = 0; i < _simQnt; i++) _simStats[i] = _sim[i]->getStats();
+   }
+
+   bool running(void)
+   {
+     return (ArduinoMock::now() - _start) < BENCH_DURATION;
+   }
+
+   void enter(void)
+   {
+     _enter = ArduinoMock::now();
+   }
+
+   void leave(void)
+   {
+     _blockedTime += ArduinoMock::now() - _enter;
+   }
+
+   void addSample(uint16_t rawValue)
+   {
+     _samples++;
+
+     if (rawValue != (100 << 3)) _badSamples++;             //simulated chip is at 25°C, code 100
+   }
+
+   void report(void)
+   {
+     const ArduinoMock::Stats &stats    = ArduinoMock::getStats();
+     uint64_t                  duration = ArduinoMock::now() - _start;
+     uint64_t                  busTime  = 0;
+     uint32_t                  aborted  = 0;
+     uint32_t                  stale    = 0;
+     double                    samples  = (_samples != 0) ? (double)_samples : 1;
+
+     for (uint8_t i = 0; i < _simQnt; i++)
+     {
+       busTime += _sim[i]->getStats().csLowTime  - _simStats[i].csLowTime;
+       aborted += _sim[i]->getStats().abortedConversions - _simStats[i].abortedConversions;
+       stale   += _sim[i]->getStats().staleReads         - _simStats[i].staleReads;
+     }
+
+     printf("%-42s %7u %10.2f %10.1f %11.2f %8.1f %8u %6u %5u\n",
+            _name,
+            _simQnt,
+            (double)_samples / _simQnt / ((double)duration / 1e9),
+            (double)busTime / samples / 1e3,
+            (double)_blockedTime / samples / 1e6,
+            (double)(stats.gpioToggleQnt - _stats.gpioToggleQnt) / samples,
+            aborted,
+            stale,
+            _badSamples);
+   }
+
+  private:
+   const char        *_name;
+   MAX6675Sim        *_sim[BENCH_MAX_SENSORS];
+   MAX6675Sim::Stats  _simStats[BENCH_MAX_SENSORS];
+   uint8_t            _simQnt;
+   uint32_t           _samples;
+   uint32_t           _badSamples;
+   uint64_t           _blockedTime;
+   uint64_t           _enter;
+   uint64_t           _start;
+   ArduinoMock::Stats _stats;
+};
+
+
+static void benchHardware(const char *name, bool freeRunning, uint64_t callerPeriod)
+{
+  ArduinoMock::reset();
+
+  Bench      bench(name);
+  MAX6675Sim sim(4);
+  MAX6675    sensor(4);
+
+  bench.attach(sim);
+
+  sensor.begin();
+  sensor.setFreeRunning(freeRunning);
+
+  bench.start();
+
+  while (bench.running())
+  {
+    uint16_t rawData = 0;
+
+    ArduinoMock::advance(callerPeriod);
+
+    bench.enter();
+    rawData = sensor.readRawData();
+    bench.leave();
+
+    bench.addSample(rawData);
+  }
+
+  bench.report();
+
+  printStats(sensor);
+}
+
+template <class SENSOR>
+static void benchHardwarePoll(const char *name)
+{
+  ArduinoMock::reset();
+
+  Bench      bench(name);
+  MAX6675Sim sim(4);
+  SENSOR     sensor(4);
+
+  bench.attach(sim);
+
+  sensor.begin();
+
+  bench.start();
+
+  while (bench.running())
+  {
+    ArduinoMock::advance(BENCH_LOOP_TIME);
+
+    bench.enter();
+    bool ready = sensor.poll();
+    bench.leave();
+
+    if (ready == true) bench.addSample(sensor.getLastRawData());
+  }
+
+  bench.report();
+}
+
+static void benchSoft(void)
+{
+  ArduinoMock::reset();
+
+  Bench       bench("MAX6675Soft::readRawData()");
+  MAX6675Sim  sim(2, 4, 7);
+  MAX6675Soft sensor(2, 4, 7);
+
+  bench.attach(sim);
+
+  sensor.begin();
+
+  bench.start();
+
+  while (bench.running())
+  {
+    uint16_t rawData = 0;
+
+    bench.enter();
+    rawData = sensor.readRawData();
+    bench.leave();
+
+    bench.addSample(rawData);
+  }
+
+  bench.report();
+
+  printStats(sensor);
+}
+
+template <class SENSOR>
+static void benchSoftFast(const char *name)
+{
+  ArduinoMock::reset();
+
+  Bench      bench(name);
+  MAX6675Sim sim(2, 4, 7);
+  SENSOR     sensor;
+
+  bench.attach(sim);
+
+  sensor.begin();
+
+  bench.start();
+
+  while (bench.running())
+  {
+    uint16_t rawData = 0;
+
+    bench.enter();
+    rawData = sensor.readRawData();
+    bench.leave();
+
+    bench.addSample(rawData);
+  }
+
+  bench.report();
+}
+
+static void benchBank(bool poll)
+{
+  ArduinoMock::reset();
+
+  Bench       bench(poll ? "MAX6675Bank::poll()" : "MAX6675Bank::readRawData()");
+  MAX6675Sim  sim0(4), sim1(5), sim2(6), sim3(8);
+  MAX6675     sensor0(4), sensor1(5), sensor2(6), sensor3(8);
+  MAX6675Bank bank;
+
+  bench.attach(sim0);
+  bench.attach(sim1);
+  bench.attach(sim2);
+  bench.attach(sim3);
+
+  sensor0.begin();
+  sensor1.begin();
+  sensor2.begin();
+  sensor3.begin();
+
+  bank.addSensor(sensor0);
+  bank.addSensor(sensor1);
+  bank.addSensor(sensor2);
+  bank.addSensor(sensor3);
+
+  bench.start();
+
+  while (bench.running())
+  {
+    if (poll == true)
+    {
+      ArduinoMock::advance(BENCH_LOOP_TIME);
+
+      bench.enter();
+      bool ready = bank.poll();
+      bench.leave();
+
+      if (ready != true) continue;
+    }
+    else
+    {
+      bench.enter();
+      bank.readRawData();
+      bench.leave();
+    }
+
+    for (uint8_t channel = 0; channel < bank.getSensorQnt(); channel++) bench.addSample(bank.getRawData(channel));
+  }
+
+  bench.report();
+}
+
+static void benchSPIBus(void)
+{
+  ArduinoMock::reset();
+
+  Bench         bench("MAX6675SPIBus::service()");
+  MAX6675Sim    sim0(4), sim1(5), sim2(6), sim3(8);
+  MAX6675       sensor0(4), sensor1(5), sensor2(6), sensor3(8);
+  MAX6675SPIBus bus;
+
+  bench.attach(sim0);
+  bench.attach(sim1);
+  bench.attach(sim2);
+  bench.attach(sim3);
+
+  sensor0.begin();
+  sensor1.begin();
+  sensor2.begin();
+  sensor3.begin();
+
+  bus.addSensor(sensor0);
+  bus.addSensor(sensor1);
+  bus.addSensor(sensor2);
+  bus.addSensor(sensor3);
+
+  bench.start();
+
+  while (bench.running())
+  {
+    ArduinoMock::advance(BENCH_LOOP_TIME);
+
+    bench.enter();
+    uint8_t readyMask = bus.service();
+    bench.leave();
+
+    for (uint8_t channel = 0; channel < bus.getSensorQnt(); channel++)
+    {
+      if (bitRead(readyMask, channel) != 0) bench.addSample(bus.getRawData(channel));
+    }
+  }
+
+  bench.report();
+}
+
+static void benchScheduler(void)
+{
+  ArduinoMock::reset();
+
+  const float       rate[BENCH_MAX_SENSORS]   = {4, 0.5, 0, 0};    //in °C per second, last sensor has open thermocouple
+  MAX6675Sim        sim[BENCH_MAX_SENSORS]    = {MAX6675Sim(4), MAX6675Sim(5), MAX6675Sim(6), MAX6675Sim(8)};
+  MAX6675           sensor[BENCH_MAX_SENSORS] = {MAX6675(4), MAX6675(5), MAX6675(6), MAX6675(8)};
+  MAX6675Scheduler  scheduler;
+  uint32_t          readQnt[BENCH_MAX_SENSORS] = {0};
+  float             maxError[BENCH_MAX_SENSORS] = {0};
+
+  for (uint8_t channel = 0; channel < BENCH_MAX_SENSORS; channel++)
+  {
+    ArduinoMock::attach(sim[channel]);
+
+    sensor[channel].begin();
+
+    scheduler.addSensor(sensor[channel]);
+  }
+
+  sim[3].setThermocoupleOpen(true);
+
+  scheduler.setBusBudget(2);
+
+  while (ArduinoMock::now() < BENCH_DURATION)
+  {
+    ArduinoMock::advance(BENCH_LOOP_TIME);
+
+    for (uint8_t channel = 0; channel < BENCH_MAX_SENSORS; channel++)
+    {
+      sim[channel].setTemperature(100 + rate[channel] * (double)ArduinoMock::now() / 1e9);
+    }
+
+    uint8_t readMask = scheduler.update();
+
+    for (uint8_t channel = 0; channel < BENCH_MAX_SENSORS; channel++)
+    {
+      if (bitRead(readMask, channel) != 0) readQnt[channel]++;
+
+      MAX6675Reading reading = scheduler.getReading(channel);
+
+      if ((reading.idValid != true) || (reading.thermocoupleOpen == true) || (readQnt[channel] == 0)) continue;
+
+      float error = 100 + rate[channel] * (double)ArduinoMock::now() / 1e9 - reading.temperature * MAX6675_RESOLUTION; //lag of the last read behind the real temperature
+
+      if (error < 0) error = -error;
+      if (error > maxError[channel]) maxError[channel] = error;
+    }
+  }
+
+  for (uint8_t channel = 0; channel < BENCH_MAX_SENSORS; channel++)
+  {
+    printf("MAX6675Scheduler channel %u, %4.1f C/s%s %10.2f samples/s %6u ms interval %6.2f C max lag\n",
+           channel, rate[channel], (channel == 3) ? ", open" : "      ", readQnt[channel] / ((double)BENCH_DURATION / 1e9),
+           scheduler.getInterval(channel), maxError[channel]);
+  }
+}
+
+static void benchSoftParallel(void)
+{
+  ArduinoMock::reset();
+
+  const uint8_t       so[BENCH_MAX_SENSORS] = {8, 9, 10, 11};
+
+  Bench               bench("MAX6675SoftParallel::readRawData()");
+  MAX6675Sim          sim0(2, 8, 7), sim1(2, 9, 7), sim2(2, 10, 7), sim3(2, 11, 7);
+  MAX6675SoftParallel sensors(2, 7, so, BENCH_MAX_SENSORS);
+
+  bench.attach(sim0);
+  bench.attach(sim1);
+  bench.attach(sim2);
+  bench.attach(sim3);
+
+  sensors.begin();
+
+  bench.start();
+
+  while (bench.running())
+  {
+    bench.enter();
+    sensors.readRawData();
+    bench.leave();
+
+    for (uint8_t channel = 0; channel < sensors.getSensorQnt(); channel++) bench.addSample(sensors.getRawData(channel));
+  }
+
+  bench.report();
+}
+
+static void benchBackground(void)
+{
+  ArduinoMock::reset();
+
+  Bench             bench("MAX6675Background::timerHandler()");
+  MAX6675Sim        sim0(4), sim1(5), sim2(6), sim3(8);
+  MAX6675           sensor0(4), sensor1(5), sensor2(6), sensor3(8);
+  MAX6675Bank       bank;
+  MAX6675Background background(bank);
+  uint64_t          timer = 0;
+
+  bench.attach(sim0);
+  bench.attach(sim1);
+  bench.attach(sim2);
+  bench.attach(sim3);
+
+  sensor0.begin();
+  sensor1.begin();
+  sensor2.begin();
+  sensor3.begin();
+
+  bank.addSensor(sensor0);
+  bank.addSensor(sensor1);
+  bank.addSensor(sensor2);
+  bank.addSensor(sensor3);
+
+  background.begin();                                        //no built-in timer on host, timer is simulated below
+
+  bench.start();
+
+  timer = ArduinoMock::now();
+
+  while (bench.running())
+  {
+    ArduinoMock::advance(BENCH_LOOP_TIME);
+
+    if ((ArduinoMock::now() - timer) >= (uint64_t)MAX6675_BACKGROUND_PERIOD * 1000000)
+    {
+      timer += (uint64_t)MAX6675_BACKGROUND_PERIOD * 1000000;
+
+      MAX6675Background::timerHandler();                     //runs in timer interrupt/task, not in loop()
+    }
+
+    bench.enter();
+    bool ready = background.available();
+    bench.leave();
+
+    if (ready != true) continue;
+
+    for (uint8_t channel = 0; channel < bank.getSensorQnt(); channel++) bench.addSample(background.getRawData(channel));
+  }
+
+  background.end();
+
+  bench.report();
+}
+
+/*
+   read + decode path in wall-clock time, transport returns constant raw data, so only
+   the call chain is measured: MAX6675 virtual _readData() vs MAX6675Driver<> template
+*/
+class MAX6675Mock : public MAX6675
+{
+  public:
+   MAX6675Mock(void) : MAX6675(4)
+   {
+   }
+
+  protected:
+   uint16_t _readData(void)
+   {
+     return 100 << 3;
+   }
+};
+
+template <class SENSOR>
+static void benchDecode(const char *name, SENSOR &sensor)
+{
+  uint32_t sum = 0;
+
+  ArduinoMock::reset();
+
+  sensor.begin();
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < BENCH_DECODE_QNT; i++)
+  {
+    uint16_t rawData     = 0;
+    int16_t  temperature = 0;
+
+    ArduinoMock::advance((uint64_t)MAX6675_CONVERSION_TIME * 1000000);
+
+    if (sensor.readIfReady(rawData) != true) continue;
+
+    sensor.getTemperatureFixed(temperature, rawData);
+
+    sum += temperature;
+  }
+
+  double time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  printf("%-42s %10.1f ns/read %s\n", name, time / BENCH_DECODE_QNT, (sum == BENCH_DECODE_QNT * 100) ? "" : "bad");
+}
+
+/*
+   MAX6675Log size & host decoder speed, 4 sensors heat up at different rate,
+   every sample is logged & decoded back
+*/
+class BenchOutput : public Print
+{
+  public:
+   size_t write(uint8_t data)
+   {
+     _data.push_back(data);
+
+     return 1;
+   }
+
+   size_t write(const uint8_t *buffer, size_t size)
+   {
+     _data.insert(_data.end(), buffer, buffer + size);
+
+     return size;
+   }
+
+   const std::vector<uint8_t> &getData(void)
+   {
+     return _data;
+   }
+
+  private:
+   std::vector<uint8_t> _data;
+};
+
+static void benchLog(void)
+{
+  ArduinoMock::reset();
+
+  MAX6675Sim                    sim[BENCH_MAX_SENSORS]    = {MAX6675Sim(4), MAX6675Sim(5), MAX6675Sim(6), MAX6675Sim(8)};
+  MAX6675                       sensor[BENCH_MAX_SENSORS] = {MAX6675(4), MAX6675(5), MAX6675(6), MAX6675(8)};
+  MAX6675SPIBus                 bus;
+  BenchOutput                   output;
+  MAX6675Log                    log(output);
+  std::vector<MAX6675LogRecord> expected;
+  std::vector<MAX6675LogRecord> decoded;
+  MAX6675LogDecoder             decoder;
+  uint32_t                      bad = 0;
+
+  for (uint8_t channel = 0; channel < BENCH_MAX_SENSORS; channel++)
+  {
+    ArduinoMock::attach(sim[channel]);
+
+    sensor[channel].begin();
+
+    bus.addSensor(sensor[channel]);
+  }
+
+  while (ArduinoMock::now() < BENCH_DURATION)
+  {
+    ArduinoMock::advance(BENCH_LOOP_TIME);
+
+    for (uint8_t channel = 0; channel < BENCH_MAX_SENSORS; channel++)
+    {
+      sim[channel].setTemperature(25 + (channel + 1) * (double)ArduinoMock::now() / 1e9); //1..4°C per second
+    }
+
+    uint8_t readyMask = bus.service();
+
+    for (uint8_t channel = 0; channel < BENCH_MAX_SENSORS; channel++)
+    {
+      if (bitRead(readyMask, channel) == 0) continue;
+
+      MAX6675LogRecord record = {(uint32_t)millis(), (uint16_t)(bus.getRawData(channel) & 0x7FFE), channel};
+
+      log.add(channel, bus.getRawData(channel), record.timestamp);
+
+      expected.push_back(record);
+    }
+  }
+
+  log.flush();
+
+  decoded.reserve(expected.size());
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  decoder.decode(output.getData().data(), output.getData().size(), decoded);
+
+  double time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  for (size_t i = 0; i < expected.size(); i++)
+  {
+    if ((i >= decoded.size()) || (decoded[i].timestamp != expected[i].timestamp) || (decoded[i].rawValue != expected[i].rawValue) || (decoded[i].channel != expected[i].channel)) bad++;
+  }
+
+  printf("%-42s %10.2f bytes/sample %8.1f ns/sample decode %u blocks %u bad\n",
+         "MAX6675Log", (double)log.getByteQnt() / log.getRecordQnt(), time / decoded.size(), decoder.getBlockQnt(), bad);
+}
+
+
+int main(void)
+{
+  printf("%-42s %7s %10s %10s %11s %8s %8s %6s %5s\n", "read path", "sensors", "samples/s", "bus us", "blocked ms", "toggles", "aborted", "stale", "bad");
+
+  benchHardware("MAX6675::readRawData()",                      false, 0);
+  benchHardware("MAX6675::readRawData() every 1sec",           false, BENCH_SLOW_PERIOD);
+  benchHardware("MAX6675::readRawData() every 1sec, free-run", true,  BENCH_SLOW_PERIOD);
+  benchHardwarePoll<MAX6675>("MAX6675::poll()");
+  benchHardwarePoll<MAX6675HwDriver>("MAX6675HwDriver::poll()");
+  benchSoft();
+  benchSoftFast<MAX6675SoftFast<2, 4, 7> >("MAX6675SoftFast::readRawData()");
+  benchSoftFast<MAX6675FastDriver<2, 4, 7> >("MAX6675FastDriver::readRawData()");
+  benchBank(false);
+  benchBank(true);
+  benchSPIBus();
+  benchSoftParallel();
+  benchBackground();
+
+  MAX6675Mock                          virtualSensor;
+  MAX6675 *volatile                    virtualPointer = &virtualSensor; //hides dynamic type, so compiler can't devirtualize
+  MAX6675Driver<MAX6675MockTransport>  templateSensor;
+
+  templateSensor.getTransport().setRawData(100 << 3);
+
+  printf("\n");
+  benchDecode("MAX6675 virtual _readData()", *virtualPointer);
+  benchDecode("MAX6675Driver<MAX6675MockTransport>", templateSensor);
+  benchLog();
+
+  printf("\n");
+  benchScheduler();
+
+  return 0;
+}
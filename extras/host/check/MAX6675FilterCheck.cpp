@@ -0,0 +1,162 @@
+/***************************************************************************************************/
+/*
+   Checks of MAX6675 filters on host, returns non-zero exit code if any check fails,
+   see src/MAX6675Filter.h
+
+   - MAX6675MovingAverage - rounded average of available samples & of the last WINDOW samples
+   - MAX6675EMA           - first sample seeds the state, step response & convergence
+   - MAX6675MedianFilter  - spike removal, 25°C -> 100°C real step re-seeds the window after
+                            MAX6675_MEDIAN_MAX_REJECTS rejects, open thermocouple restarts
+                            the window
+
+   build & run:
+   cmake -S . -B build && cmake --build build && ctest --test-dir build
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <stdio.h>
+
+#include <MAX6675Filter.h>
+
+#define RAW(temperature) ((uint16_t)((temperature) << 3)) //quarter-degrees to raw data, D14..D3
+#define RAW_OPEN         ((uint16_t)0x0004)                //D2 is high, thermocouple is open
+#define RAW_ID_ERROR     ((uint16_t)0xFFFF)                //D1 is high, SO floats
+
+static unsigned int failQnt = 0;
+
+
+static void check(bool passed, const char *name, long value, long expected)
+{
+  if (passed == true) return;
+
+  failQnt++;
+
+  printf("FAIL %-58s got %ld, expected %ld\n", name, value, expected);
+}
+
+static void checkEqual(const char *name, long value, long expected)
+{
+  check(value == expected, name, value, expected);
+}
+
+
+static void checkMovingAverage(void)
+{
+  MAX6675MovingAverage<4> filter;
+
+  checkEqual("moving average, no samples",                        filter.getValue(), 0);
+
+  checkEqual("moving average, update() accepts sample",           filter.update(RAW(100)), true);
+  checkEqual("moving average, 1 sample",                          filter.getValue(), 100);
+
+  filter.update(RAW(101));
+  checkEqual("moving average, 2 samples rounded",                 filter.getValue(), 101); //(201 + 1) / 2
+
+  filter.update(RAW(108));
+  filter.update(RAW(112));
+  checkEqual("moving average, full window",                       filter.getValue(), 105); //(421 + 2) / 4
+  checkEqual("moving average, sample qnt.",                       filter.getSampleQnt(), 4);
+
+  filter.update(RAW(120));
+  checkEqual("moving average, oldest sample is dropped",          filter.getValue(), 110); //(101 + 108 + 112 + 120 + 2) / 4
+  checkEqual("moving average, sample qnt. saturates at WINDOW",   filter.getSampleQnt(), 4);
+
+  checkEqual("moving average, open thermocouple is ignored",      filter.update(RAW(400) | RAW_OPEN), false);
+  checkEqual("moving average, ID error is ignored",               filter.update(RAW_ID_ERROR), false);
+  checkEqual("moving average, value after ignored samples",       filter.getValue(), 110);
+
+  filter.reset();
+  checkEqual("moving average, reset()",                           filter.getSampleQnt(), 0);
+}
+
+
+static void checkEMA(void)
+{
+  MAX6675EMA filter(3);                                            //alpha = 1/8
+
+  checkEqual("EMA, no samples",                                   filter.getValue(), 0);
+
+  filter.update(RAW(100));
+  checkEqual("EMA, first sample seeds the state",                 filter.getValue(), 100);
+
+  for (uint8_t i = 0; i < 8; i++) filter.update(RAW(200));
+
+  int16_t value = filter.getValue();                               //100 + 100 * (1 - (7/8)^8) = 165.6
+
+  check((value >= 164) && (value <= 166), "EMA, step response after 8 samples", value, 166);
+
+  for (uint8_t i = 0; i < 100; i++) filter.update(RAW(200));
+  checkEqual("EMA, converges to the step",                        filter.getValue(), 200);
+
+  for (uint8_t i = 0; i < 100; i++) filter.update(RAW(100));
+  checkEqual("EMA, converges down to the step",                   filter.getValue(), 100);
+
+  checkEqual("EMA, open thermocouple is ignored",                 filter.update(RAW(400) | RAW_OPEN), false);
+  checkEqual("EMA, value after ignored sample",                   filter.getValue(), 100);
+  checkEqual("EMA, sample qnt.",                                  filter.getSampleQnt(), 209);
+}
+
+
+static void checkMedian(void)
+{
+  MAX6675MedianFilter spike;                                       //rejection disabled
+  MAX6675MedianFilter filter(40);                                  //10°C max step
+
+  spike.update(RAW(100));
+  spike.update(RAW(100));
+  spike.update(RAW(400));
+  checkEqual("median, single spike is removed",                   spike.getValue(), 100);
+
+  /* 25°C -> 100°C step, e.g. heater turned on */
+  for (uint8_t i = 0; i < 3; i++) filter.update(RAW(100));
+  checkEqual("median, 25C",                                       filter.getValue(), 100);
+
+  for (uint8_t i = 1; i < MAX6675_MEDIAN_MAX_REJECTS; i++)
+  {
+    checkEqual("median, 100C step is rejected at first",          filter.update(RAW(400)), false);
+    checkEqual("median, value isn't changed by rejected sample",  filter.getValue(), 100);
+  }
+
+  checkEqual("median, 100C step is accepted after max rejects",   filter.update(RAW(400)), true);
+  checkEqual("median, window is re-seeded from 100C",             filter.getValue(), 400);
+  checkEqual("median, sample qnt. after re-seed",                 filter.getSampleQnt(), 1);
+  checkEqual("median, rejected qnt.",                             filter.getRejectedQnt(), MAX6675_MEDIAN_MAX_REJECTS);
+
+  filter.update(RAW(401));
+  filter.update(RAW(402));
+  checkEqual("median, 100C window is full",                       filter.getValue(), 401);
+
+  checkEqual("median, spike after re-seed is rejected",           filter.update(RAW(100)), false);
+  checkEqual("median, sample after spike is accepted",            filter.update(RAW(402)), true);
+  checkEqual("median, value after spike",                         filter.getValue(), 402);
+
+  /* open thermocouple restarts the window & keeps the last value */
+  checkEqual("median, open thermocouple is ignored",              filter.update(RAW(400) | RAW_OPEN), false);
+  checkEqual("median, last value is kept while open",             filter.getValue(), 402);
+  checkEqual("median, window is cleared while open",              filter.getSampleQnt(), 0);
+
+  checkEqual("median, sample after reconnect isn't rejected",     filter.update(RAW(100)), true);
+  checkEqual("median, value after reconnect",                     filter.getValue(), 100);
+}
+
+
+int main(void)
+{
+  checkMovingAverage();
+  checkEMA();
+  checkMedian();
+
+  if (failQnt != 0)
+  {
+    printf("%u filter checks failed\n", failQnt);
+
+    return 1;
+  }
+
+  printf("all filter checks passed\n");
+
+  return 0;
+}
@@ -0,0 +1,149 @@
+/***************************************************************************************************/
+/*
+   Host decoder of MAX6675Log binary blocks, see src/MAX6675Log.cpp
+
+   - block, little endian:
+     offset size
+     0      2    magic 0x6675
+     2      1    qnt. of records
+     3      1    payload size in bytes
+     4      4    timestamp of the first record, in milliseconds
+     8      ...  records
+   - record:
+     - channel, 1 byte, 0..7
+     - time since previous record in the block, unsigned LEB128 varint
+     - zigzag LEB128 varint difference of D14..D1 with previous record of the
+       same channel in the block, first record of the channel is difference with 0
+   - damaged block is skipped byte by byte until the next valid header,
+     so truncated or partly overwritten file is still decoded
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675LogDecoder_h
+#define MAX6675LogDecoder_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#define MAX6675_LOG_DECODER_MAGIC        0x6675
+#define MAX6675_LOG_DECODER_HEADER_SIZE  8
+#define MAX6675_LOG_DECODER_MAX_CHANNELS 8
+
+
+struct MAX6675LogRecord
+{
+  uint32_t timestamp;                        //in milliseconds
+  uint16_t rawValue;                         //D14..D1 of raw data, D15 & D0 are zero
+  uint8_t  channel;
+};
+
+
+class MAX6675LogDecoder
+{
+  public:
+   MAX6675LogDecoder(void) : _blockQnt(0), _skippedByteQnt(0)
+   {
+   }
+
+   /* appends decoded records of all valid blocks in data to records, returns qnt. of appended records */
+   size_t decode(const uint8_t *data, size_t size, std::vector<MAX6675LogRecord> &records)
+   {
+     size_t offset = 0;
+     size_t first  = records.size();
+
+     while ((offset + MAX6675_LOG_DECODER_HEADER_SIZE) <= size)
+     {
+       size_t blockSize = _decodeBlock(data + offset, size - offset, records);
+
+       if (blockSize == 0)
+       {
+         _skippedByteQnt++;                                          //resync on next byte
+         offset++;
+
+         continue;
+       }
+
+       _blockQnt++;
+       offset += blockSize;
+     }
+
+     _skippedByteQnt += size - offset;
+
+     return records.size() - first;
+   }
+
+   uint32_t getBlockQnt(void)       {return _blockQnt;}
+   uint32_t getSkippedByteQnt(void) {return _skippedByteQnt;}
+
+  private:
+   uint32_t _blockQnt;
+   uint32_t _skippedByteQnt;
+
+   /* returns block size in bytes or 0 if block is damaged, records are appended only if the whole block is valid */
+   size_t _decodeBlock(const uint8_t *block, size_t size, std::vector<MAX6675LogRecord> &records)
+   {
+     if ((block[0] | (block[1] << 8)) != MAX6675_LOG_DECODER_MAGIC) return 0;
+
+     uint8_t  recordQnt   = block[2];
+     size_t   payloadSize = block[3];
+     uint32_t timestamp   = block[4] | (block[5] << 8) | (block[6] << 16) | ((uint32_t)block[7] << 24);
+
+     if ((recordQnt == 0) || ((MAX6675_LOG_DECODER_HEADER_SIZE + payloadSize) > size)) return 0;
+
+     const uint8_t *data      = block + MAX6675_LOG_DECODER_HEADER_SIZE;
+     const uint8_t *end       = data + payloadSize;
+     uint16_t       lastValue[MAX6675_LOG_DECODER_MAX_CHANNELS] = {0};
+     size_t         first     = records.size();
+
+     uint8_t        i         = 0;
+
+     records.resize(first + recordQnt);
+
+     for (i = 0; i < recordQnt; i++)
+     {
+       uint32_t dt     = 0;
+       uint32_t zigzag = 0;
+
+       if ((data >= end) || (*data >= MAX6675_LOG_DECODER_MAX_CHANNELS)) break;
+
+       uint8_t channel = *data++;
+
+       if ((_getVarint(data, end, dt) != true) || (_getVarint(data, end, zigzag) != true) || (zigzag > 0xFFFF)) break;
+
+       timestamp         += dt;
+       lastValue[channel] = (lastValue[channel] + (uint16_t)((zigzag >> 1) ^ (0 - (zigzag & 0x01)))) & 0x3FFF;
+
+       records[first + i].timestamp = timestamp;
+       records[first + i].rawValue  = lastValue[channel] << 1;
+       records[first + i].channel   = channel;
+     }
+
+     if ((i == recordQnt) && (data == end)) return MAX6675_LOG_DECODER_HEADER_SIZE + payloadSize;
+
+     records.resize(first);                                          //damaged block, drop partly decoded records
+
+     return 0;
+   }
+
+   static bool _getVarint(const uint8_t *&data, const uint8_t *end, uint32_t &value)
+   {
+     value = 0;
+
+     for (uint8_t shift = 0; (shift < 35) && (data < end); shift += 7)
+     {
+       uint8_t byte = *data++;
+
+       value |= (uint32_t)(byte & 0x7F) << shift;
+
+       if ((byte & 0x80) == 0) return true;
+     }
+
+     return false;
+   }
+};
+
+#endif
@@ -0,0 +1,71 @@
+/***************************************************************************************************/
+/*
+   Expands MAX6675Log binary file into CSV for analysis, see MAX6675LogDecoder.h
+
+   - columns: time ms, channel, raw data, temperature °C, thermocouple open, chip ID valid
+   - temperature is empty if thermocouple is open or chip ID is wrong
+
+   build & run:
+   cmake -S . -B build && cmake --build build && ./build/max6675_logdump LOG.BIN > log.csv
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include <MAX6675LogDecoder.h>
+
+
+int main(int argc, char **argv)
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s LOG.BIN|-\n", argv[0]);
+
+    return 2;
+  }
+
+  FILE *file = (strcmp(argv[1], "-") == 0) ? stdin : fopen(argv[1], "rb");
+
+  if (file == NULL)
+  {
+    perror(argv[1]);
+
+    return 1;
+  }
+
+  std::vector<uint8_t> data;
+  uint8_t              chunk[65536];
+  size_t               size = 0;
+
+  while ((size = fread(chunk, 1, sizeof(chunk), file)) > 0) data.insert(data.end(), chunk, chunk + size);
+
+  if (file != stdin) fclose(file);
+
+  MAX6675LogDecoder             decoder;
+  std::vector<MAX6675LogRecord> records;
+
+  records.reserve(data.size() / 2);                                  //record is at least 3 bytes, but header is shared
+
+  decoder.decode(data.data(), data.size(), records);
+
+  printf("time_ms,channel,raw,temperature_c,open,id_valid\n");
+
+  for (size_t i = 0; i < records.size(); i++)
+  {
+    const MAX6675LogRecord &record = records[i];
+    bool                    open   = (record.rawValue & 0x0004) != 0;
+    bool                    id     = (record.rawValue & 0x0002) == 0;
+
+    if ((open != true) && (id == true)) printf("%u,%u,%u,%.2f,%u,%u\n", record.timestamp, record.channel, record.rawValue, ((record.rawValue >> 3) & 0x0FFF) * 0.25, open, id);
+    else                                printf("%u,%u,%u,,%u,%u\n",     record.timestamp, record.channel, record.rawValue, open, id);
+  }
+
+  fprintf(stderr, "%u blocks, %zu records, %u bytes skipped\n", decoder.getBlockQnt(), records.size(), decoder.getSkippedByteQnt());
+
+  return 0;
+}
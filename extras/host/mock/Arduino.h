@@ -0,0 +1,107 @@
+/***************************************************************************************************/
+/*
+   Host mock of the Arduino core for building & benchmarking MAX6675 library on Linux
+
+   - virtual clock, delay()/delayMicroseconds()/yield() advance it instead of sleeping
+   - GPIO with simulated MAX6675 chips attached to the pins, see MAX6675Sim.h
+   - every core call costs configurable virtual time, defaults are close to
+     5v-16MHz AVR, see ArduinoMock::Costs
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define HIGH        0x1
+#define LOW         0x0
+
+#define INPUT       0x0
+#define OUTPUT      0x1
+
+#define MSBFIRST    1
+#define LSBFIRST    0
+
+#define MOCK_PIN_QNT 64 //two 32-bit ports
+
+#define bitRead(value, bit)  (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit)   ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+
+#define digitalPinToPort(pin)    ((uint8_t)((pin) / 32))
+#define digitalPinToBitMask(pin) ((uint32_t)1 << ((pin) % 32))
+#define portInputRegister(port)  (ArduinoMock::getPortRegister(port))
+
+#define PROGMEM                                 //host has one address space
+#define pgm_read_byte(address)  (*(const uint8_t *)(address))
+#define pgm_read_word(address)  (*(const uint16_t *)(address))
+
+typedef uint8_t byte;
+
+void          pinMode(uint8_t pin, uint8_t mode);
+void          digitalWrite(uint8_t pin, uint8_t value);
+int           digitalRead(uint8_t pin);
+void          delay(unsigned long ms);
+void          delayMicroseconds(unsigned int us);
+unsigned long millis(void);
+unsigned long micros(void);
+void          yield(void);
+void          noInterrupts(void);
+void          interrupts(void);
+
+
+class Print                                  //byte output only, no text formatting
+{
+  public:
+   virtual ~Print(void) {}
+
+   virtual size_t write(uint8_t data) = 0;
+   virtual size_t write(const uint8_t *buffer, size_t size);
+};
+
+
+class MAX6675Sim;
+
+namespace ArduinoMock
+{
+  struct Costs                               //virtual time of every core call, in nanoseconds
+  {
+    uint32_t digitalWrite;
+    uint32_t digitalRead;
+    uint32_t micros;
+    uint32_t yield;
+    uint32_t spiTransaction;                 //SPI.beginTransaction() + SPI.endTransaction()
+  };
+
+  struct Stats
+  {
+    uint64_t digitalWriteQnt;
+    uint64_t digitalReadQnt;
+    uint64_t gpioToggleQnt;                  //digitalWrite() that changed pin level
+    uint64_t spiTransferQnt;                 //SPI.transfer()/transfer16() calls
+    uint64_t spiBusTime;                     //in nanoseconds, SPI clocking
+    uint64_t blockedTime;                    //in nanoseconds, delay()/delayMicroseconds()/yield()
+  };
+
+  void                   reset(void);
+  void                   setCosts(const Costs &costs);
+  const Costs           &getCosts(void);
+  const Stats           &getStats(void);
+
+  uint64_t               now(void);          //virtual time, in nanoseconds
+  void                   advance(uint64_t ns);
+  void                   block(uint64_t ns); //advance & count as blocked time
+
+  void                   attach(MAX6675Sim &sim);
+  bool                   getPinLevel(uint8_t pin);
+  uint16_t               spiTransfer(uint8_t bits, uint32_t clock);
+  volatile uint32_t     *getPortRegister(uint8_t port);
+}
+
+#endif
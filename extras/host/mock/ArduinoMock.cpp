@@ -0,0 +1,258 @@
+/***************************************************************************************************/
+/*
+   Host mock of the Arduino core & SPI library, see Arduino.h & SPI.h for details
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <vector>
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <MAX6675Sim.h>
+
+
+SPIClass SPI;
+
+static const ArduinoMock::Costs mockDefaultCosts =
+{
+  3500,                                                     //digitalWrite(), pin mapping lookup & cli/sei on 16MHz AVR
+  3000,                                                     //digitalRead()
+  4000,                                                     //micros()
+  100,                                                      //yield(), empty on AVR, one loop pass
+  2000                                                      //SPI.beginTransaction() + SPI.endTransaction()
+};
+
+static ArduinoMock::Costs        mockCosts     = mockDefaultCosts;
+static ArduinoMock::Stats        mockStats;
+static uint64_t                  mockNow       = 0;
+static bool                      mockLevel[MOCK_PIN_QNT];
+static volatile uint32_t         mockPort[MOCK_PIN_QNT / 32];
+static std::vector<MAX6675Sim *> mockSims;
+
+
+static void mockUpdatePorts(void)
+{
+  for (uint8_t port = 0; port < (MOCK_PIN_QNT / 32); port++)
+  {
+    uint32_t value = 0;
+
+    for (uint8_t bit = 0; bit < 32; bit++)
+    {
+      if (ArduinoMock::getPinLevel(port * 32 + bit) == true) value |= ((uint32_t)1 << bit);
+    }
+
+    mockPort[port] = value;
+  }
+}
+
+
+/* ArduinoMock */
+void ArduinoMock::reset(void)
+{
+  mockCosts = mockDefaultCosts;
+  mockNow   = 0;
+
+  memset(&mockStats, 0, sizeof(mockStats));
+  memset(mockLevel,  0, sizeof(mockLevel));
+
+  mockSims.clear();
+
+  mockUpdatePorts();
+}
+
+void ArduinoMock::setCosts(const Costs &costs)
+{
+  mockCosts = costs;
+}
+
+const ArduinoMock::Costs &ArduinoMock::getCosts(void)
+{
+  return mockCosts;
+}
+
+const ArduinoMock::Stats &ArduinoMock::getStats(void)
+{
+  return mockStats;
+}
+
+uint64_t ArduinoMock::now(void)
+{
+  return mockNow;
+}
+
+void ArduinoMock::advance(uint64_t ns)
+{
+  mockNow += ns;
+}
+
+void ArduinoMock::block(uint64_t ns)
+{
+  mockNow               += ns;
+  mockStats.blockedTime += ns;
+}
+
+void ArduinoMock::attach(MAX6675Sim &sim)
+{
+  mockSims.push_back(&sim);
+
+  mockUpdatePorts();
+}
+
+bool ArduinoMock::getPinLevel(uint8_t pin)
+{
+  bool level = false;
+
+  for (size_t i = 0; i < mockSims.size(); i++)
+  {
+    if (mockSims[i]->drivesPin(pin, level) == true) return level;
+  }
+
+  return (pin < MOCK_PIN_QNT) ? mockLevel[pin] : false;
+}
+
+uint16_t ArduinoMock::spiTransfer(uint8_t bits, uint32_t clock)
+{
+  uint64_t busTime = ((uint64_t)bits * 1000000000ULL) / clock;
+
+  mockNow              += busTime;
+  mockStats.spiBusTime += busTime;
+  mockStats.spiTransferQnt++;
+
+  for (size_t i = 0; i < mockSims.size(); i++)
+  {
+    if (mockSims[i]->isSelected() != true) continue;
+
+    return (bits == 16) ? mockSims[i]->transfer16() : mockSims[i]->transfer();
+  }
+
+  return (bits == 16) ? 0xFFFF : 0xFF;                                            //MISO floats high if no slave is selected
+}
+
+volatile uint32_t *ArduinoMock::getPortRegister(uint8_t port)
+{
+  return &mockPort[port % (MOCK_PIN_QNT / 32)];
+}
+
+
+/* Arduino core */
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  bool level = (value != LOW);
+
+  mockNow += mockCosts.digitalWrite;
+  mockStats.digitalWriteQnt++;
+
+  if (pin >= MOCK_PIN_QNT) return;
+
+  if (mockLevel[pin] != level) mockStats.gpioToggleQnt++;
+
+  mockLevel[pin] = level;
+
+  for (size_t i = 0; i < mockSims.size(); i++) mockSims[i]->onPinChange(pin, level);
+
+  mockUpdatePorts();
+}
+
+int digitalRead(uint8_t pin)
+{
+  mockNow += mockCosts.digitalRead;
+  mockStats.digitalReadQnt++;
+
+  return (ArduinoMock::getPinLevel(pin) == true) ? HIGH : LOW;
+}
+
+void delay(unsigned long ms)
+{
+  ArduinoMock::block((uint64_t)ms * 1000000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  ArduinoMock::block((uint64_t)us * 1000);
+}
+
+unsigned long millis(void)
+{
+  mockNow += mockCosts.micros;
+
+  return (unsigned long)(uint32_t)(mockNow / 1000000);
+}
+
+unsigned long micros(void)
+{
+  mockNow += mockCosts.micros;
+
+  return (unsigned long)(uint32_t)(mockNow / 1000);
+}
+
+void yield(void)
+{
+  ArduinoMock::block(mockCosts.yield);
+}
+
+void noInterrupts(void)
+{
+}
+
+void interrupts(void)
+{
+}
+
+
+/* SPI */
+void SPIClass::begin(void)
+{
+}
+
+void SPIClass::end(void)
+{
+}
+
+void SPIClass::beginTransaction(SPISettings settings)
+{
+  _settings = settings;
+
+  mockNow += mockCosts.spiTransaction / 2;
+}
+
+void SPIClass::endTransaction(void)
+{
+  mockNow += mockCosts.spiTransaction / 2;
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+  (void)data;
+
+  return (uint8_t)ArduinoMock::spiTransfer(8, _settings._clock);
+}
+
+uint16_t SPIClass::transfer16(uint16_t data)
+{
+  (void)data;
+
+  return ArduinoMock::spiTransfer(16, _settings._clock);
+}
+
+void SPIClass::usingInterrupt(uint8_t interruptNumber)
+{
+  (void)interruptNumber;
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t written = 0;
+
+  while ((written < size) && (write(buffer[written]) == 1)) written++;
+
+  return written;
+}
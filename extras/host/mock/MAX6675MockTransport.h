@@ -0,0 +1,44 @@
+/***************************************************************************************************/
+/*
+   Host transport for MAX6675Driver<>, returns raw data set by test/benchmark
+   without any pin or bus activity
+
+   - every call only updates counters, so read + decode path of the driver
+     can be measured & checked on its own
+   - MAX6675Driver<MAX6675MockTransport> sensor; sensor.getTransport().setRawData(100 << 3);
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675MockTransport_h
+#define MAX6675MockTransport_h
+
+#include <Arduino.h>
+
+
+class MAX6675MockTransport
+{
+  public:
+   MAX6675MockTransport(void) : _rawData(0), _beginQnt(0), _pulseQnt(0), _transferQnt(0)
+   {
+   }
+
+   void     begin(void)                {_beginQnt++;}
+   void     pulseCS(void)              {_pulseQnt++;}
+   uint16_t transfer(void)             {_transferQnt++; return _rawData;}
+
+   void     setRawData(uint16_t value) {_rawData = value;}
+   uint32_t getBeginQnt(void)          {return _beginQnt;}
+   uint32_t getPulseQnt(void)          {return _pulseQnt;}
+   uint32_t getTransferQnt(void)       {return _transferQnt;}
+
+  private:
+   uint16_t _rawData;
+   uint32_t _beginQnt;
+   uint32_t _pulseQnt;
+   uint32_t _transferQnt;
+};
+
+#endif
@@ -0,0 +1,152 @@
+/***************************************************************************************************/
+/*
+   Timing-accurate host model of 12-bit MAX6675 K-Thermocouple to Digital Converter,
+   see MAX6675Sim.h for details
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX6675Sim.h>
+
+
+MAX6675Sim::MAX6675Sim(uint8_t cs, uint8_t so, uint8_t sck)
+{
+  _cs              = cs;
+  _so              = so;
+  _sck             = sck;
+  _csLevel         = false;                      //pinMode(OUTPUT) pulls pin low, conversion starts on the first CS rising edge
+  _sckLevel        = false;
+  _open            = false;
+  _stale           = true;
+  _counted         = true;
+  _code            = 100;                        //25°C
+  _result          = 0;                          //power-up value, never converted
+  _shift           = 0;
+  _bit             = -1;
+  _conversionStart = 0;
+  _csLowStart      = 0;
+
+  memset(&_stats, 0, sizeof(_stats));
+}
+
+void MAX6675Sim::setTemperature(float temperature)
+{
+  if      (temperature < 0)       _code = 0;
+  else if (temperature > 1023.75) _code = 4095;
+  else                            _code = (uint16_t)(temperature * 4 + 0.5);
+}
+
+void MAX6675Sim::setThermocoupleOpen(bool open)
+{
+  _open = open;
+}
+
+const MAX6675Sim::Stats &MAX6675Sim::getStats(void)
+{
+  return _stats;
+}
+
+void MAX6675Sim::onPinChange(uint8_t pin, bool level)
+{
+  if (pin == _cs)
+  {
+    if (level == _csLevel) return;
+
+    _csLevel = level;
+
+    if (level == true)                                      //rising edge, interface disabled & new conversion started
+    {
+      _conversionStart  = ArduinoMock::now();
+      _stats.csLowTime += _conversionStart - _csLowStart;
+      _bit              = -1;
+    }
+    else                                                    //falling edge, conversion stopped & result latched
+    {
+      _csLowStart = ArduinoMock::now();
+
+      if ((_csLowStart - _conversionStart) >= MAX6675_SIM_CONVERSION_TIME)
+      {
+        _result = _convert();
+        _stale  = false;
+      }
+      else
+      {
+        _stale  = true;
+        _stats.abortedConversions++;
+      }
+
+      _shift   = _result;
+      _bit     = 15;
+      _counted = false;
+    }
+  }
+
+  if ((pin == _sck) && (_sckLevel != level))
+  {
+    _sckLevel = level;
+
+    if ((level == false) && (_csLevel == false) && (_bit >= 0))      //next bit is clocked out on falling edge
+    {
+      _countRead();
+      _bit--;
+    }
+  }
+}
+
+bool MAX6675Sim::isSelected(void)
+{
+  return (_csLevel == false) && (_bit >= 0);
+}
+
+bool MAX6675Sim::drivesPin(uint8_t pin, bool &level)
+{
+  if ((pin != _so) || (isSelected() != true)) return false; //SO is high impedance while CS is high
+
+  level = bitRead(_shift, _bit);
+
+  return true;
+}
+
+uint16_t MAX6675Sim::transfer16(void)
+{
+  uint16_t data = (uint16_t)((transfer() << 8));
+
+  return data | transfer();
+}
+
+uint8_t MAX6675Sim::transfer(void)
+{
+  uint8_t data = 0;
+
+  _countRead();
+
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    data = (data << 1) | ((_bit >= 0) ? bitRead(_shift, _bit) : 0);
+
+    if (_bit >= 0) _bit--;
+  }
+
+  return data;
+}
+
+void MAX6675Sim::_countRead(void)
+{
+  if (_counted == true) return;
+
+  if (_stale == true) _stats.staleReads++;
+  else                _stats.freshReads++;
+
+  _counted = true;
+}
+
+uint16_t MAX6675Sim::_convert(void)
+{
+  uint16_t data = (uint16_t)(_code << 3);                   //D15 is dummy sign bit, D14..D3 temperature
+
+  if (_open == true) data |= (1 << 2);                      //D2 high if thermocouple is open, D1 is ID & always low
+
+  return data;
+}
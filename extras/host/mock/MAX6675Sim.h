@@ -0,0 +1,71 @@
+/***************************************************************************************************/
+/*
+   Timing-accurate host model of 12-bit MAX6675 K-Thermocouple to Digital Converter
+
+   - while CS is high the chip converts continuously, every conversion takes
+     MAX6675_SIM_CONVERSION_TIME
+   - forcing CS low immediately stops conversion & latches the result of the last
+     completed conversion, if CS was high less than conversion time the result
+     is stale (previous one) & conversion is counted as aborted
+   - D15 is output on CS falling edge, next bit on every SCK falling edge,
+     see MAX6675::readRawData() for data format
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675Sim_h
+#define MAX6675Sim_h
+
+#include <Arduino.h>
+
+#define MAX6675_SIM_CONVERSION_TIME 220000000ULL //in nanoseconds, datasheet max
+#define MAX6675_SIM_NO_PIN          0xFF         //SO & SCK aren't used with hardware SPI
+
+
+class MAX6675Sim
+{
+  public:
+   struct Stats
+   {
+     uint32_t freshReads;                        //data clocked out after completed conversion
+     uint32_t staleReads;                        //data clocked out after aborted conversion, previous result
+     uint32_t abortedConversions;                //CS went low before conversion was completed
+     uint64_t csLowTime;                         //in nanoseconds, time serial interface was enabled
+   };
+
+   MAX6675Sim(uint8_t cs, uint8_t so = MAX6675_SIM_NO_PIN, uint8_t sck = MAX6675_SIM_NO_PIN);
+
+   void         setTemperature(float temperature);
+   void         setThermocoupleOpen(bool open);
+   const Stats &getStats(void);
+
+   void         onPinChange(uint8_t pin, bool level);
+   bool         isSelected(void);
+   bool         drivesPin(uint8_t pin, bool &level);
+   uint16_t     transfer16(void);
+   uint8_t      transfer(void);
+
+  private:
+   uint8_t  _cs;
+   uint8_t  _so;
+   uint8_t  _sck;
+   bool     _csLevel;
+   bool     _sckLevel;
+   bool     _open;
+   bool     _stale;                              //latched result is from previous conversion
+   bool     _counted;                            //read of latched result is already counted
+   uint16_t _code;                               //0..4095, 0.25°C per step
+   uint16_t _result;                             //latched result of the last completed conversion
+   uint16_t _shift;
+   int8_t   _bit;                                //next bit on SO, 15..0, -1 after all bits are out
+   uint64_t _conversionStart;
+   uint64_t _csLowStart;
+   Stats    _stats;
+
+   uint16_t _convert(void);
+   void     _countRead(void);
+};
+
+#endif
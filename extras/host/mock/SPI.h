@@ -0,0 +1,53 @@
+/***************************************************************************************************/
+/*
+   Host mock of the Arduino SPI library for building & benchmarking MAX6675 library on Linux
+
+   - transfer is served by simulated MAX6675 whose CS is low, see MAX6675Sim.h
+   - bus time is 8 or 16 SCK periods at the clock of the current transaction
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef _SPI_H_INCLUDED
+#define _SPI_H_INCLUDED
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+
+class SPISettings
+{
+  public:
+   SPISettings(void) : _clock(4000000), _bitOrder(MSBFIRST), _dataMode(SPI_MODE0) {}
+   SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) : _clock(clock), _bitOrder(bitOrder), _dataMode(dataMode) {}
+
+   uint32_t _clock;
+   uint8_t  _bitOrder;
+   uint8_t  _dataMode;
+};
+
+
+class SPIClass
+{
+  public:
+   void     begin(void);
+   void     end(void);
+   void     beginTransaction(SPISettings settings);
+   void     endTransaction(void);
+   uint8_t  transfer(uint8_t data);
+   uint16_t transfer16(uint16_t data);
+   void     usingInterrupt(uint8_t interruptNumber);
+
+  private:
+   SPISettings _settings;
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+Generates src/MAX6675KTypeTable.h, K-type linearization & cold junction correction
+tables for MAX6675KType, see src/MAX6675KType.cpp
+
+- MAX6675 assumes linear thermocouple with 41.276uV/C (NIST E(1000C) / 1000C) & adds
+  cold junction temperature as linear voltage, so the code is:
+  code / 4 * 41.276uV = E(T) - E(Tcj) + 41.276uV * Tcj
+- true temperature is T = E^-1(code / 4 * 41.276uV + E(Tcj) - 41.276uV * Tcj), E() is
+  NIST ITS-90 type K reference function, E^-1() is found by bisection
+- temperature table has 2^(12 - segment bits) + 2 points in 1/16C, linear interpolation
+  between points, cold junction table is offset in 1/16 code for every C of -20..85C
+
+usage:
+python3 extras/tools/max6675_ktype_table.py [--segment-bits 5] [--output src/MAX6675KTypeTable.h]
+
+GNU GPL license, all text above must be included in any redistribution,
+see link for details  - https://www.gnu.org/licenses/licenses.html
+"""
+
+import argparse
+import math
+import sys
+
+SEEBECK       = 0.041276                     # mV/C, MAX6675 linear slope
+CODE_FRACTION = 4                            # table input is code in 1/16 code
+TEMP_FRACTION = 4                            # table output is temperature in 1/16C
+CJ_MIN        = -20                          # MAX6675 cold junction compensation range, C
+CJ_MAX        = 85
+
+# NIST ITS-90 type K, E in mV, T in C
+K_NEGATIVE = [0.0, 0.394501280250e-01, 0.236223735980e-04, -0.328589067840e-06, -0.499048287770e-08,
+              -0.675090591730e-10, -0.574103274280e-12, -0.310888728940e-14, -0.104516093650e-16,
+              -0.198892668780e-19, -0.163226974860e-22]
+K_POSITIVE = [-0.176004136860e-01, 0.389212049750e-01, 0.185587700320e-04, -0.994575928740e-07,
+              0.318409457190e-09, -0.560728448890e-12, 0.560750590590e-15, -0.320207200030e-18,
+              0.971511471520e-22, -0.121047212750e-25]
+K_EXPONENT = (0.118597600000e+00, -0.118343200000e-03, 0.126968600000e+03)
+
+
+def emf(t):
+    """thermocouple voltage in mV for junction temperature t in C, cold junction at 0C"""
+    if t < 0:
+        return sum(c * t ** i for i, c in enumerate(K_NEGATIVE))
+
+    a0, a1, a2 = K_EXPONENT
+
+    return sum(c * t ** i for i, c in enumerate(K_POSITIVE)) + a0 * math.exp(a1 * (t - a2) ** 2)
+
+
+def temperature(e):
+    """inverse of emf(), -270..1372C"""
+    low, high = -270.0, 1372.0
+
+    for _ in range(60):
+        middle = (low + high) / 2
+
+        if emf(middle) < e:
+            low = middle
+        else:
+            high = middle
+
+    return (low + high) / 2
+
+
+def cold_junction_offset(tcj):
+    """code offset that turns chip code into E(T) / 41.276uV * 4, in codes"""
+    return (emf(tcj) - SEEBECK * tcj) / SEEBECK * 4
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--segment-bits", type=int, default=5, help="log2 of codes per segment, 0..8, 5 is 128 segments")
+    parser.add_argument("--output",       default="src/MAX6675KTypeTable.h")
+    args = parser.parse_args()
+
+    if not 0 <= args.segment_bits <= 8:
+        parser.error("--segment-bits must be 0..8")
+
+    segment_codes = 1 << args.segment_bits
+    points        = 4096 // segment_codes + 2    # one extra segment above code 4095 for cold junction offset
+
+    table   = [round(temperature(i * segment_codes / 4 * SEEBECK) * (1 << TEMP_FRACTION)) for i in range(points)]
+    offsets = [round(cold_junction_offset(tcj) * (1 << CODE_FRACTION)) for tcj in range(CJ_MIN, CJ_MAX + 1)]
+
+    if max(abs(o) for o in offsets) > 127:
+        sys.exit("cold junction offset doesn't fit int8_t")
+
+    # worst error of interpolated table against exact inverse for all codes & cold junction temperatures
+    error = 0.0
+
+    for tcj in range(CJ_MIN, CJ_MAX + 1, 5):
+        offset = offsets[tcj - CJ_MIN]
+
+        for code in range(4096):
+            code_fx  = min(max((code << CODE_FRACTION) + offset, 0), ((points - 1) << (args.segment_bits + CODE_FRACTION)) - 1)
+            shift    = args.segment_bits + CODE_FRACTION
+            segment  = code_fx >> shift
+            fraction = code_fx & ((1 << shift) - 1)
+            result   = table[segment] + (((table[segment + 1] - table[segment]) * fraction) >> shift)
+            exact    = temperature(code / 4 * SEEBECK + emf(tcj) - SEEBECK * tcj)
+
+            if code_fx == (code << CODE_FRACTION) + offset:
+                error = max(error, abs(result / (1 << TEMP_FRACTION) - exact))
+
+    lines = []
+    lines.append("/***************************************************************************************************/")
+    lines.append("/*")
+    lines.append("   K-type linearization & cold junction correction tables for MAX6675KType")
+    lines.append("")
+    lines.append("   generated by extras/tools/max6675_ktype_table.py --segment-bits %d, don't edit" % args.segment_bits)
+    lines.append("   NIST ITS-90 type K reference function, max interpolation error %.3f C" % error)
+    lines.append("")
+    lines.append("   GNU GPL license, all text above must be included in any redistribution,")
+    lines.append("   see link for details  - https://www.gnu.org/licenses/licenses.html")
+    lines.append("*/")
+    lines.append("/***************************************************************************************************/")
+    lines.append("")
+    lines.append("#ifndef MAX6675KTypeTable_h")
+    lines.append("#define MAX6675KTypeTable_h")
+    lines.append("")
+    lines.append("#define MAX6675_KTYPE_SEGMENT_BITS       %-5d //log2 of codes per table segment" % args.segment_bits)
+    lines.append("#define MAX6675_KTYPE_POINTS             %-5d //temperature table size" % points)
+    lines.append("#define MAX6675_KTYPE_CODE_FRACTION_BITS %-5d //cold junction offset is in 1/16 code" % CODE_FRACTION)
+    lines.append("#define MAX6675_KTYPE_TEMP_FRACTION_BITS %-5d //temperature table is in 1/16C" % TEMP_FRACTION)
+    lines.append("#define MAX6675_KTYPE_CJ_MIN             %-5d //cold junction table range, C" % CJ_MIN)
+    lines.append("#define MAX6675_KTYPE_CJ_MAX             %d" % CJ_MAX)
+    lines.append("")
+    lines.append("static const int16_t max6675KTypeTable[MAX6675_KTYPE_POINTS] PROGMEM =")
+    lines.append("{")
+    for i in range(0, points, 12):
+        lines.append("  " + " ".join("%6d," % v for v in table[i:i + 12]))
+    lines[-1] = lines[-1].rstrip(",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const int8_t max6675KTypeColdJunction[MAX6675_KTYPE_CJ_MAX - MAX6675_KTYPE_CJ_MIN + 1] PROGMEM =")
+    lines.append("{")
+    for i in range(0, len(offsets), 16):
+        lines.append("  " + " ".join("%4d," % v for v in offsets[i:i + 16]))
+    lines[-1] = lines[-1].rstrip(",")
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif")
+
+    with open(args.output, "w") as output:
+        output.write("\n".join(lines) + "\n")
+
+    print("%s: %d points, max interpolation error %.3f C" % (args.output, points, error))
+
+
+if __name__ == "__main__":
+    main()
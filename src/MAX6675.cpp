@@ -44,6 +44,7 @@
 
 #include <MAX6675.h>
 
+
 /**************************************************************************/
 /*
     MAX6675()
@@ -56,7 +57,16 @@
 /**************************************************************************/
 MAX6675::MAX6675(uint8_t cs)
 {
-  _cs = cs; //cs chip select
+  _cs              = cs;                 //cs chip select
+  _state           = MAX6675_STATE_IDLE;
+  _freeRunning     = false;
+  _conversionStart = 0;
+  _lastRawData     = 0;
+  _hardwareSPI     = false;
+
+  #ifdef MAX6675_ENABLE_STATS
+  resetStats();
+  #endif
 }
 
 /**************************************************************************/
@@ -68,10 +78,167 @@ MAX6675::MAX6675(uint8_t cs)
 /**************************************************************************/
 void MAX6675::begin(void)
 {
-  pinMode(_cs, OUTPUT);
-  digitalWrite(_cs, HIGH); //disables SPI interface for MAX6675, but it will initiate measurement/conversion
+  MAX6675HardwareSPI(_cs).begin(); //CS high initiates measurement/conversion, see MAX6675Transport.h
+
+  _conversionStart = micros();
+  _state           = MAX6675_STATE_CONVERTING;
+  _hardwareSPI     = true;         //data is read via SPI.transfer16(), see MAX6675SPIBus
+}
+
+/**************************************************************************/
+/*
+    setFreeRunning()
+
+    Enables/disables free-running read mode
+
+    NOTE:
+    - while CS is high MAX6675 converts continuously, so the result of
+      the last conversion is already in the chip if CS has been high
+      for at least MAX6675_CONVERSION_TIME
+    - free-running mode "false" (default), readRawData() aborts current
+      conversion & always waits a fresh one ~220msec
+    - free-running mode "true", readRawData() reads the data immediately
+      if CS has been high long enough, otherwise waits only the remaining
+      conversion time
+*/
+/**************************************************************************/
+void MAX6675::setFreeRunning(bool enable)
+{
+  _freeRunning = enable;
+}
+
+/**************************************************************************/
+/*
+    startConversion()
+
+    Aborts current conversion & starts a new one, doesn't block
+
+    NOTE:
+    - forcing CS low immediately stops any conversion process, force CS high
+      to initiate a new measurement process
+    - result is available after MAX6675_CONVERSION_TIME, see isReady()
+*/
+/**************************************************************************/
+void MAX6675::startConversion(void)
+{
+  digitalWrite(_cs, LOW);      //stop  measurement/conversion
+  delayMicroseconds(1);        //4MHz  is 0.25μsec, do we need it???
+  digitalWrite(_cs, HIGH);     //start measurement/conversion
+
+  _conversionStart = micros();
+  _state           = MAX6675_STATE_CONVERTING;
+}
+
+/**************************************************************************/
+/*
+    isReady()
+
+    Returns true if conversion time has passed since CS was forced high
+
+    NOTE:
+    - micros() is used instead of millis() because AVR millis() counter
+      jumps by 2 every ~42msec & may return ready ~1msec too early
+    - unsigned subtraction is roll over safe
+*/
+/**************************************************************************/
+bool MAX6675::isReady(void)
+{
+  if (_state != MAX6675_STATE_CONVERTING) return false;
+
+  return ((micros() - _conversionStart) >= ((uint32_t)MAX6675_CONVERSION_TIME * 1000));
+}
+
+/**************************************************************************/
+/*
+    readIfReady()
+
+    Reads raw data if conversion is done, returns true on success,
+    doesn't block
+
+    NOTE:
+    - CS goes high at the end of the read & initiates next conversion
+*/
+/**************************************************************************/
+bool MAX6675::readIfReady(uint16_t &rawValue)
+{
+  if (isReady() != true) return false;
+
+  #ifdef MAX6675_ENABLE_STATS
+  uint32_t readStart = micros();
+  #endif
+
+  rawValue         = _readData();
+  _lastRawData     = rawValue;
+
+  _conversionStart = micros();             //CS is high again & new conversion is in progress
+
+  #ifdef MAX6675_ENABLE_STATS
+  if (_waiting == true) _stats.waitTime += readStart - _waitStart;
+
+  _updateStats(rawValue, _conversionStart - readStart, _conversionStart - ((_waiting == true) ? _waitStart : readStart));
+  #endif
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    poll()
+
+    Non-blocking state machine, call it as often as possible from the loop(),
+    returns true when new raw data is available, see getLastRawData()
+
+    NOTE:
+    - IDLE       -> start conversion, go to CONVERTING
+    - CONVERTING -> read data when conversion time has passed,
+                    next conversion starts automatically, stay in CONVERTING
+*/
+/**************************************************************************/
+bool MAX6675::poll(void)
+{
+  uint16_t rawData = 0;
+
+  switch (_state)
+  {
+    case MAX6675_STATE_IDLE:
+      startConversion();
+      return false;
+
+    case MAX6675_STATE_CONVERTING:
+      return readIfReady(rawData);
+  }
+
+  return false;
+}
+
+/**************************************************************************/
+/*
+    getLastRawData()
+
+    Returns last raw data received by readIfReady(), poll() or readRawData()
+*/
+/**************************************************************************/
+uint16_t MAX6675::getLastRawData(void)
+{
+  return _lastRawData;
+}
 
-  SPI.begin();             //setting hardware SCK, MOSI, SS to output, pull SCK, MOSI low & SS high      
+/**************************************************************************/
+/*
+    read()
+
+    Reads raw data from MAX6675 & decodes it, one bus transaction for
+    temperature, thermocouple & chip ID status
+
+    NOTE:
+    - blocks same as readRawData(), honors free-running mode
+    - use it instead of getChipID(), detectThermocouple() & getTemperature()
+      with default argument, every one of them triggers new readRawData()
+*/
+/**************************************************************************/
+MAX6675Reading MAX6675::read(void)
+{
+  return decodeRawData(readRawData());
 }
 
 /**************************************************************************/
@@ -85,11 +252,14 @@ void MAX6675::begin(void)
       is broken or unplugged
     - to allow the operation of the open thermocouple detector the
       "T-" pin must be grounded!!!
+    - returns false if chip ID is wrong, SO floats high if the chip isn't connected
 */
 /**************************************************************************/
 bool MAX6675::detectThermocouple(uint16_t rawValue)
 {
-  return ~bitRead(rawValue, 2);
+  if (rawValue == MAX6675_FORCE_READ_DATA) rawValue = readRawData();
+
+  return (decodeStatus(rawValue) == MAX6675_NO_ERROR);
 }
 
 /**************************************************************************/
@@ -106,81 +276,180 @@ uint16_t MAX6675::getChipID(uint16_t rawValue)
 {
   if (rawValue == MAX6675_FORCE_READ_DATA) rawValue = readRawData();
 
-  if (bitRead(rawValue, 1) == 0) return MAX6675_ID;
+  if (decodeStatus(rawValue) != MAX6675_ID_ERROR) return MAX6675_ID;
 
   return 0;
 }
 
 /**************************************************************************/
 /*
-    getTemperature()
+    getTemperatureFixed()
 
-    Reads Temperature, °C
+    Reads Temperature as fixed-point integer, returns status
 
     NOTE:
     - bits D14..D3 contain the converted temperature in the order of MSB to LSB.
     - sequence of all zeros on SO pin means the thermocouple reading is 0°C
     - sequence of all ones  on SO pin means the thermocouple reading is +1023.75°C
+    - fractionBits is qnt. of fractional bits, temperature = °C * 2^fractionBits
+      - 2 (default) quarter-degrees, 0..4095 is 0°C..+1023.75°C
+      - 0 whole degrees,             0..1023
+      - 4 1/16 degrees,              0..16380
+      - values above MAX6675_MAX_FRACTION_BITS are limited to it
+    - decoding uses shifts only, no float math is pulled in on 8-bit AVR
+    - status:
+      - MAX6675_NO_ERROR
+      - MAX6675_THERMOCOUPLE_OPEN, thermocouple is broken, unplugged or "T-" isn't grounded
+      - MAX6675_ID_ERROR, bit D1 is high, chip isn't connected or communication error
+    - temperature is set to 0 if status isn't MAX6675_NO_ERROR
+    - decoding is done by decodeTemperatureFixed(), shared with MAX6675Driver<>
 */
 /**************************************************************************/
-float MAX6675::getTemperature(uint16_t rawValue)
+uint8_t MAX6675::getTemperatureFixed(int16_t &temperature, uint16_t rawValue, uint8_t fractionBits)
 {
   if (rawValue == MAX6675_FORCE_READ_DATA) rawValue = readRawData();
 
-  if (detectThermocouple(rawValue) != true || getChipID(rawValue) != MAX6675_ID) return MAX6675_ERROR;
+  return decodeTemperatureFixed(temperature, rawValue, fractionBits);
+}
+
+/**************************************************************************/
+/*
+    getTemperature()
+
+    Reads Temperature, °C
 
-  rawValue = rawValue >> 3; //clear D2..D0 bits, rawValue - 0..4095
+    NOTE:
+    - float wrapper over getTemperatureFixed(), unused function is removed
+      by linker & soft-float library isn't pulled in
+    - returns MAX6675_ERROR if thermocouple is open or chip ID is wrong,
+      see getTemperatureFixed() for details
+*/
+/**************************************************************************/
+float MAX6675::getTemperature(uint16_t rawValue)
+{
+  if (rawValue == MAX6675_FORCE_READ_DATA) rawValue = readRawData();
 
-  return (float)rawValue * MAX6675_RESOLUTION;
+  return decodeTemperature(rawValue);
 }
 
 /**************************************************************************/
 /*
     readRawData()
 
-    Reads raw data from MAX6675, bit-banging implementation
+    Starts new conversion & reads raw data from MAX6675, blocks
+    for MAX6675_CONVERSION_TIME
 
     NOTE:
-    - forcing CS low immediately stops any conversion process, force CS high
-      to initiate a new measurement process
-    - set CS low to enable the serial interface & force to output the first bit on the SO pin,
-      apply 16 clock signals at SCK to read the results at SO on the falling edge of the SCK
-    - bit D15 is a dummy sign bit and is always zero.
-    - bits D14..D3 contain the converted temperature in the order of MSB to LSB
-    - bit D2 is normally low & goes high when the thermocouple is broken or unplugged
-      to allow the operation of the open thermocouple detector the "T-" pin must be grounded
-    - bit D1 is low to provide a device ID for the MAX6675
-    - bit D0 is three-state
-    - sequence of all zeros on SO pin means the thermocouple reading is 0°C
-    - sequence of all ones  on SO pin means the thermocouple reading is +1023.75°C
-
-    - arduino 8-bit AVR maximum SPI master clock speed is mcu speed/2,
-      for 5v-16MHz/ProMini speed is 16000000/2=8MHz 
-    - arduino ESP8266 maximum SPI master clock speed is 80000000=80MHz
-    - arduino STM32 maximum SPI master clock speed is mcu speed/2,
-      for STM32F103C8 speed is 72000000/2=36MHz
-    - SPI_MODE0 -> data available shortly after the rising edge of SCK
+    - blocking wrapper over startConversion() & readIfReady(),
+      use poll() if you can't wait ~220msec
+    - in free-running mode conversion isn't restarted, waits only
+      the remaining conversion time, see setFreeRunning()
 */
 /**************************************************************************/
 uint16_t MAX6675::readRawData(void)
 {
   uint16_t rawData = 0;
 
-  digitalWrite(_cs, LOW);                                          //stop  measurement/conversion
-  delayMicroseconds(1);                                            //4MHz  is 0.25μsec, do we need it???
-  digitalWrite(_cs, HIGH);                                         //start measurement/conversion
+  #ifdef MAX6675_ENABLE_STATS
+  _waitStart = micros();
+  _waiting   = true;
+  #endif
 
-  delay(MAX6675_CONVERSION_TIME);
+  if ((_freeRunning != true) || (_state != MAX6675_STATE_CONVERTING)) startConversion();
 
-  SPI.beginTransaction(SPISettings(4000000, MSBFIRST, SPI_MODE0)); //up to 4MHz, read MSB first, SPI mode 0, see note
+  while (readIfReady(rawData) != true)
+  {
+    yield();                                                       //prevents ESP8266/ESP32 watchdog reset
+  }
 
-  digitalWrite(_cs, LOW);                                          //set software CS low to enable SPI interface for MAX6675
+  #ifdef MAX6675_ENABLE_STATS
+  _waiting = false;
+  #endif
 
-  rawData = SPI.transfer16(0x0000);                                //chip has read only SPI & MOSI not connected, so it doesn't metter what to send
- 
-  digitalWrite(_cs, HIGH);                                         //disables SPI interface for MAX6675, but it will initiate measurement/conversion
+  return rawData;
+}
 
-  SPI.endTransaction();                                            //de-asserting hardware CS & free hw SPI for other slaves
+#ifdef MAX6675_ENABLE_STATS
+/**************************************************************************/
+/*
+    getStats()
 
-  return rawData;
+    Copies counters of the instance, see MAX6675Stats
+
+    NOTE:
+    - counters roll over, export difference with previous call or
+      call resetStats() after every export
+    - latency is time caller was blocked to get the reading, whole
+      readRawData() call or only data transfer for readIfReady()/poll()
+    - available only if MAX6675_ENABLE_STATS is defined, see MAX6675.h
+*/
+/**************************************************************************/
+void MAX6675::getStats(MAX6675Stats &stats)
+{
+  stats = _stats;
+}
+
+/**************************************************************************/
+/*
+    resetStats()
+
+    Clears all counters of the instance
+*/
+/**************************************************************************/
+void MAX6675::resetStats(void)
+{
+  _stats = MAX6675Stats();                                        //all counters are zero
+
+  _waitStart = 0;
+  _waiting   = false;
+}
+
+/**************************************************************************/
+/*
+    _updateStats()
+
+    Counts received raw data, bus time & latency
+
+    NOTE:
+    - latency bucket is bit length of latency in milliseconds,
+      0 is <1msec, 1 is 1msec, 2 is 2..3msec, 3 is 4..7msec, etc.
+*/
+/**************************************************************************/
+void MAX6675::_updateStats(uint16_t rawValue, uint32_t busTime, uint32_t latency)
+{
+  uint8_t bucket = 0;
+
+  _stats.readQnt++;
+  _stats.busTime += busTime;
+
+  if (bitRead(rawValue, 2) != 0) _stats.openQnt++;
+  if (bitRead(rawValue, 1) != 0) _stats.idErrorQnt++;
+  if (rawValue == 0x0000)        _stats.stuckLowQnt++;
+  if (rawValue == 0xFFFF)        _stats.stuckHighQnt++;
+
+  latency = latency / 1000;                                        //to milliseconds
+
+  while ((latency != 0) && (bucket < (MAX6675_STATS_LATENCY_BUCKETS - 1)))
+  {
+    latency >>= 1;
+    bucket++;
+  }
+
+  if (_stats.latency[bucket] != 0xFFFF) _stats.latency[bucket]++;
+}
+#endif
+
+/**************************************************************************/
+/*
+    _readData()
+
+    Reads raw data from MAX6675 via hardware SPI
+
+    NOTE:
+    - transport is shared with MAX6675Driver<>, see MAX6675HardwareSPI::transfer()
+*/
+/**************************************************************************/
+uint16_t MAX6675::_readData(void)
+{
+  return MAX6675HardwareSPI(_cs).transfer();
 }
@@ -59,9 +59,17 @@
 #include <avr/pgmspace.h>                  //use for PROGMEM Arduino STM32
 #endif
 
-#ifndef  MAX6675_SOFT_SPI                  //enable upload hw driver spi.h
-#include <SPI.h>
-#endif
+#include <MAX6675Transport.h>         //hardware & software SPI read, SPI clock & bit-bang options
+
+/*
+   Unfortunately, you cannot #define something in the sketch & get
+   it in the library, because the Arduino toolchain includes library
+   files & compiles them in advance, not knowing where it will be used.
+
+   - uncomment to count reads, errors & time spent by every instance, see getStats(),
+     costs ~60 bytes of RAM per instance & 1 extra micros() call per read
+*/
+//#define MAX6675_ENABLE_STATS
 
 #define MAX6675_CONVERSION_TIME 220    //in milliseconds, sampling rate ~4...5Hz
 #define MAX6675_RESOLUTION      0.25   //in deg.C per dac step
@@ -69,22 +77,197 @@
 #define MAX6675_ID              6675
 #define MAX6675_FORCE_READ_DATA 0x8002 //force to read the data, is unique because d15d1 can't be high
 #define MAX6675_ERROR           2000   //returned value if any error happends
+#define MAX6675_NO_DATA         0xFFFF //returned raw data if channel doesn't exist, D1 is high so it never passes ID check
+
+#define MAX6675_FRACTION_BITS     2    //native fixed-point scale, 1/2^2=0.25°C per dac step
+#define MAX6675_MAX_FRACTION_BITS 5    //4095 << (5 - 2) = 32760 is max for int16_t
+
+#define MAX6675_NO_ERROR          0x00 //returned status
+#define MAX6675_THERMOCOUPLE_OPEN 0x01
+#define MAX6675_ID_ERROR          0x02
+
+#define MAX6675_STATS_LATENCY_BUCKETS 10 //read latency histogram, <1, 1, 2..3, 4..7, ..., 128..255, >=256 msec
+
+#define MAX6675_STATE_IDLE       0x00  //no conversion in progress, CS state unknown
+#define MAX6675_STATE_CONVERTING 0x01  //CS is high & conversion is in progress or done
+
+typedef struct
+{
+  uint16_t rawValue;                   //raw data, bits D15..D0
+  int16_t  temperature;                //bits D14..D3 in quarter-degrees, 0..4095 is 0°C..+1023.75°C, valid only if no error
+  bool     thermocoupleOpen;           //bit D2 is high, thermocouple is broken, unplugged or "T-" isn't grounded
+  bool     idValid;                    //bit D1 is low, chip is connected
+} MAX6675Reading;
+
+#ifdef MAX6675_ENABLE_STATS
+typedef struct
+{
+  uint32_t readQnt;                    //raw data words received
+  uint32_t openQnt;                    //D2 is high, thermocouple is open
+  uint32_t idErrorQnt;                 //D1 is high, chip isn't connected or communication error
+  uint32_t stuckLowQnt;                //0x0000, SO is stuck low, it is also valid 0°C reading
+  uint32_t stuckHighQnt;               //0xFFFF, SO is stuck high or floats, also counted as ID error
+  uint32_t waitTime;                   //in microseconds, blocked in readRawData() till the end of conversion
+  uint32_t busTime;                    //in microseconds, data transfer with CS low
+  uint32_t irqOffTime;                 //in microseconds, interrupts were disabled by soft SPI, see MAX6675_DISABLE_INTERRUPTS
+  uint16_t latency[MAX6675_STATS_LATENCY_BUCKETS]; //qnt. of reads by time caller was blocked, saturates at 65535
+} MAX6675Stats;
+#endif
+
 
 class MAX6675
 {
+  friend class MAX6675Bank;
+  friend class MAX6675SPIBus;
+
   public:
    MAX6675(uint8_t cs);
 
-            void     begin(void);
-            bool     detectThermocouple(uint16_t rawValue = MAX6675_FORCE_READ_DATA);
-            uint16_t getChipID(uint16_t rawValue = MAX6675_FORCE_READ_DATA);
-            float    getTemperature(uint16_t rawValue = MAX6675_FORCE_READ_DATA);
-    virtual uint16_t readRawData(void);
+            void           begin(void);
+            void           setFreeRunning(bool enable);
+            void           startConversion(void);
+            bool           isReady(void);
+            bool           readIfReady(uint16_t &rawValue);
+            bool           poll(void);
+            uint16_t       getLastRawData(void);
+            MAX6675Reading read(void);
+     static MAX6675Reading decodeRawData(uint16_t rawValue);
+     static uint8_t        decodeStatus(uint16_t rawValue);
+     static uint8_t        decodeTemperatureFixed(int16_t &temperature, uint16_t rawValue, uint8_t fractionBits = MAX6675_FRACTION_BITS);
+     static float          decodeTemperature(uint16_t rawValue);
+            bool           detectThermocouple(uint16_t rawValue = MAX6675_FORCE_READ_DATA);
+            uint16_t       getChipID(uint16_t rawValue = MAX6675_FORCE_READ_DATA);
+            uint8_t        getTemperatureFixed(int16_t &temperature, uint16_t rawValue = MAX6675_FORCE_READ_DATA, uint8_t fractionBits = MAX6675_FRACTION_BITS);
+            float          getTemperature(uint16_t rawValue = MAX6675_FORCE_READ_DATA);
+            uint16_t       readRawData(void);
+            #ifdef MAX6675_ENABLE_STATS
+            void           getStats(MAX6675Stats &stats);
+            void           resetStats(void);
+            #endif
 
   private:
 
   protected:
-   uint8_t _cs;
+   uint8_t  _cs;
+   uint8_t  _state;
+   bool     _freeRunning;
+   uint32_t _conversionStart; //in microseconds, time when CS was forced high
+   uint16_t _lastRawData;
+   bool     _hardwareSPI;     //set by MAX6675::begin(), MAX6675Soft & MAX6675SoftFast have their own begin()
+
+   #ifdef MAX6675_ENABLE_STATS
+   MAX6675Stats _stats;
+   uint32_t     _waitStart;   //in microseconds, readRawData() call time
+   bool         _waiting;     //readRawData() is in progress
+
+           void _updateStats(uint16_t rawValue, uint32_t busTime, uint32_t latency);
+   #endif
+
+   virtual uint16_t _readData(void);
 };
 
+/**************************************************************************/
+/*
+    decodeRawData()
+
+    Decodes raw data in one pass, doesn't need the chip, so it can be called
+    as MAX6675::decodeRawData() for data received from MAX6675Bank,
+    MAX6675SoftParallel, etc.
+
+    NOTE:
+    - bit D15 is a dummy sign bit and is always zero.
+    - bits D14..D3 contain the converted temperature in the order of MSB to LSB
+    - bit D2 is normally low & goes high when the thermocouple is broken or unplugged
+    - bit D1 is low to provide a device ID for the MAX6675
+    - defined in header, so read & decode path of MAX6675Driver<> can be inlined
+*/
+/**************************************************************************/
+inline MAX6675Reading MAX6675::decodeRawData(uint16_t rawValue)
+{
+  MAX6675Reading reading;
+
+  reading.rawValue         = rawValue;
+  reading.temperature      = (rawValue >> 3) & 0x0FFF;      //clear D2..D0 bits, 0..4095
+  reading.thermocoupleOpen = (bitRead(rawValue, 2) != 0);
+  reading.idValid          = (bitRead(rawValue, 1) == 0);
+
+  return reading;
+}
+
+/**************************************************************************/
+/*
+    decodeStatus()
+
+    Returns status of raw data, doesn't need the chip
+
+    NOTE:
+    - status:
+      - MAX6675_NO_ERROR
+      - MAX6675_THERMOCOUPLE_OPEN, thermocouple is broken, unplugged or "T-" isn't grounded
+      - MAX6675_ID_ERROR, bit D1 is high, chip isn't connected or communication error
+    - ID error is checked first, SO floats high if the chip isn't connected
+      & D2 is high too
+*/
+/**************************************************************************/
+inline uint8_t MAX6675::decodeStatus(uint16_t rawValue)
+{
+  if (bitRead(rawValue, 1) != 0) return MAX6675_ID_ERROR;          //D1 must be low
+  if (bitRead(rawValue, 2) != 0) return MAX6675_THERMOCOUPLE_OPEN; //D2 goes high if thermocouple is open
+
+  return MAX6675_NO_ERROR;
+}
+
+/**************************************************************************/
+/*
+    decodeTemperatureFixed()
+
+    Decodes raw data to fixed-point temperature, returns status, doesn't
+    need the chip, shared by MAX6675, MAX6675Soft & MAX6675Driver<>
+
+    NOTE:
+    - fractionBits is qnt. of fractional bits, temperature = °C * 2^fractionBits,
+      values above MAX6675_MAX_FRACTION_BITS are limited to it
+    - temperature is set to 0 if status isn't MAX6675_NO_ERROR
+    - see MAX6675::getTemperatureFixed() for details
+*/
+/**************************************************************************/
+inline uint8_t MAX6675::decodeTemperatureFixed(int16_t &temperature, uint16_t rawValue, uint8_t fractionBits)
+{
+  uint8_t status = decodeStatus(rawValue);
+
+  temperature = 0;
+
+  if (status != MAX6675_NO_ERROR) return status;
+
+  if (fractionBits > MAX6675_MAX_FRACTION_BITS) fractionBits = MAX6675_MAX_FRACTION_BITS;
+
+  temperature = (rawValue >> 3) & 0x0FFF;                           //clear D2..D0 bits, 0..4095 quarter-degrees
+
+  if (fractionBits >= MAX6675_FRACTION_BITS) temperature = temperature << (fractionBits - MAX6675_FRACTION_BITS);
+  else                                       temperature = temperature >> (MAX6675_FRACTION_BITS - fractionBits);
+
+  return MAX6675_NO_ERROR;
+}
+
+/**************************************************************************/
+/*
+    decodeTemperature()
+
+    Decodes raw data to °C, returns MAX6675_ERROR if thermocouple is open
+    or chip ID is wrong, doesn't need the chip
+
+    NOTE:
+    - float wrapper over decodeTemperatureFixed(), unused inline function
+      isn't compiled & soft-float library isn't pulled in
+*/
+/**************************************************************************/
+inline float MAX6675::decodeTemperature(uint16_t rawValue)
+{
+  int16_t temperature = 0;
+
+  if (decodeTemperatureFixed(temperature, rawValue) != MAX6675_NO_ERROR) return MAX6675_ERROR;
+
+  return (float)temperature * MAX6675_RESOLUTION;
+}
+
 #endif
@@ -0,0 +1,448 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675Background reads MAX6675Bank from timer
+   interrupt/task at maximum sampling rate ~4..5Hz & delivers results to the user
+   callback, so the loop() never waits for conversion or SPI.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX6675Background.h>
+
+
+MAX6675Background *MAX6675Background::_instance = 0;
+
+/*
+   short critical section for read-then-clear of the flags shared with
+   the timer, restores previous interrupt state, so it is safe inside ISR
+*/
+#if defined(__AVR__)
+#define MAX6675_BACKGROUND_LOCK(background)   uint8_t oldSREG = SREG; cli()
+#define MAX6675_BACKGROUND_UNLOCK(background) SREG = oldSREG
+#elif defined(ESP32)
+#define MAX6675_BACKGROUND_LOCK(background)   portENTER_CRITICAL(&(background)->_lock)
+#define MAX6675_BACKGROUND_UNLOCK(background) portEXIT_CRITICAL(&(background)->_lock)
+#elif defined(ARDUINO_ARCH_STM32)
+#define MAX6675_BACKGROUND_LOCK(background)   uint32_t oldPRIMASK = __get_PRIMASK(); __disable_irq()
+#define MAX6675_BACKGROUND_UNLOCK(background) __set_PRIMASK(oldPRIMASK)
+#else
+#define MAX6675_BACKGROUND_LOCK(background)   noInterrupts()
+#define MAX6675_BACKGROUND_UNLOCK(background) interrupts()
+#endif
+
+#if defined(ESP32)
+/**************************************************************************/
+/*
+    max6675TimerCallback()
+
+    esp_timer callback, runs in high priority esp_timer task
+
+    NOTE:
+    - esp_timer callbacks must not block, SPI.beginTransaction() waits
+      for the bus lock, so callback only requests the read & service()
+      does it from the loop()
+*/
+/**************************************************************************/
+static void max6675TimerCallback(void *arg)
+{
+  (void)arg;
+
+  MAX6675Background::timerInterrupt();
+}
+
+#elif defined(ESP8266)
+/**************************************************************************/
+/*
+    max6675TimerCallback()
+
+    os_timer callback, runs in SYS context
+*/
+/**************************************************************************/
+static void max6675TimerCallback(void *arg)
+{
+  (void)arg;
+
+  MAX6675Background::timerHandler();
+}
+
+#elif defined(ARDUINO_ARCH_STM32) && defined(MAX6675_BACKGROUND_STM32_TIMER)
+static HardwareTimer *max6675Timer = 0;                              //interrupt calls timerInterrupt(), read is done by service()
+
+#elif defined(__AVR__) && defined(MAX6675_BACKGROUND_AVR_TIMER0)
+static volatile uint8_t max6675TimerTicks = 0;
+
+/**************************************************************************/
+/*
+    ISR(TIMER0_COMPB_vect)
+
+    Timer0 compare B interrupt, fires every 1.024msec together with millis()
+    overflow interrupt
+*/
+/**************************************************************************/
+ISR(TIMER0_COMPB_vect)
+{
+  if (++max6675TimerTicks < MAX6675_BACKGROUND_PERIOD) return;
+
+  max6675TimerTicks = 0;
+
+  MAX6675Background::timerHandler();
+}
+#endif
+
+
+/**************************************************************************/
+/*
+    MAX6675Background()
+
+    Constructor for background acquisition
+
+    NOTE:
+    - call begin() of every sensor & add all sensors to the bank before
+      begin() of background acquisition
+*/
+/**************************************************************************/
+MAX6675Background::MAX6675Background(MAX6675Bank &bank)
+{
+  _bank       = &bank;
+  _callback   = 0;
+  _ringBuffer  = 0;
+  _available   = false;
+  _readPending = false;
+
+  #if defined(ESP32)
+  _lock        = portMUX_INITIALIZER_UNLOCKED;
+  #endif
+
+  for (uint8_t i = 0; i < MAX6675_BANK_MAX_SENSORS; i++) _rawData[i] = MAX6675_NO_DATA;
+}
+
+/**************************************************************************/
+/*
+    begin()
+
+    Starts background acquisition, returns false if built-in timer isn't
+    available or failed to start
+
+    NOTE:
+    - ESP32   uses esp_timer, timer only requests the read, call service()
+              from the loop(), callback runs in the loop(), use MAX6675Task
+              to read from own FreeRTOS task
+    - ESP8266 uses os_timer,  callback runs in SYS context
+    - STM32   uses HardwareTimer, see MAX6675_BACKGROUND_STM32_TIMER,
+              interrupt only requests the read, call service() from the loop(),
+              callback runs in the loop()
+    - AVR     uses Timer0 compare B interrupt, see MAX6675_BACKGROUND_AVR_TIMER0,
+              callback runs in interrupt
+    - on any other board begin() returns false, call timerInterrupt() every
+      MAX6675_BACKGROUND_PERIOD from your own timer interrupt & service()
+      from the loop()
+    - callback is called for every channel after every read, keep it short,
+      it must not use delay() or Serial
+    - only one background acquisition can run at a time
+    - direct memory access isn't used, transfer of 2 bytes takes 4μsec
+      at 4MHz & it is shorter than DMA setup
+*/
+/**************************************************************************/
+bool MAX6675Background::begin(MAX6675Callback callback)
+{
+  if ((_instance != 0) || (_bank->getSensorQnt() == 0)) return false;
+
+  _callback    = callback;
+  _available   = false;
+  _readPending = false;
+
+  _bank->startConversion();                                          //conversion of all sensors is in progress, timer just collects results
+
+  _instance  = this;
+
+  #if defined(ESP32)
+  esp_timer_create_args_t timerArgs;
+
+  timerArgs.callback        = &max6675TimerCallback;
+  timerArgs.arg             = 0;
+  timerArgs.dispatch_method = ESP_TIMER_TASK;
+  timerArgs.name            = "max6675";
+
+  if ((esp_timer_create(&timerArgs, &_timer) != ESP_OK) ||
+      (esp_timer_start_periodic(_timer, (uint64_t)MAX6675_BACKGROUND_PERIOD * 1000) != ESP_OK))
+  {
+    _instance = 0;
+
+    return false;
+  }
+
+  return true;
+
+  #elif defined(ESP8266)
+  os_timer_disarm(&_timer);
+  os_timer_setfn(&_timer, &max6675TimerCallback, 0);
+  os_timer_arm(&_timer, MAX6675_BACKGROUND_PERIOD, true);            //true - repeat
+
+  return true;
+
+  #elif defined(ARDUINO_ARCH_STM32) && defined(MAX6675_BACKGROUND_STM32_TIMER)
+  static HardwareTimer timer(MAX6675_BACKGROUND_STM32_TIMER);
+
+  max6675Timer = &timer;
+
+  max6675Timer->setOverflow((uint32_t)MAX6675_BACKGROUND_PERIOD * 1000, MICROSEC_FORMAT);
+  max6675Timer->attachInterrupt(&MAX6675Background::timerInterrupt);
+  max6675Timer->resume();
+
+  return true;
+
+  #elif defined(__AVR__) && defined(MAX6675_BACKGROUND_AVR_TIMER0)
+  SPI.usingInterrupt(255);                                           //SPI.beginTransaction() in the loop() disables interrupts, so ISR never breaks other SPI transaction
+
+  max6675TimerTicks = 0;
+
+  OCR0B   = 0x80;                                                    //fire in the middle of millis() overflow period
+  TIMSK0 |= _BV(OCIE0B);                                             //enable Timer0 compare B interrupt
+
+  return true;
+
+  #else
+  return false;                                                      //no built-in timer, call timerHandler() from your own timer
+  #endif
+}
+
+/**************************************************************************/
+/*
+    end()
+
+    Stops background acquisition
+*/
+/**************************************************************************/
+void MAX6675Background::end(void)
+{
+  if (_instance != this) return;
+
+  #if defined(ESP32)
+  esp_timer_stop(_timer);
+  esp_timer_delete(_timer);
+
+  #elif defined(ESP8266)
+  os_timer_disarm(&_timer);
+
+  #elif defined(ARDUINO_ARCH_STM32) && defined(MAX6675_BACKGROUND_STM32_TIMER)
+  max6675Timer->pause();
+  max6675Timer->detachInterrupt();
+
+  #elif defined(__AVR__) && defined(MAX6675_BACKGROUND_AVR_TIMER0)
+  TIMSK0 &= ~_BV(OCIE0B);                                            //disable Timer0 compare B interrupt
+  #endif
+
+  _instance = 0;
+}
+
+/**************************************************************************/
+/*
+    setRingBuffer()
+
+    Sets ring buffer, every sample of every channel is pushed into it
+    with micros() timestamp
+
+    NOTE:
+    - background acquisition is the only producer, drain the buffer
+      from one consumer, loop() or one task
+    - set the buffer before begin()
+*/
+/**************************************************************************/
+void MAX6675Background::setRingBuffer(MAX6675RingBuffer &ringBuffer)
+{
+  _ringBuffer = &ringBuffer;
+}
+
+/**************************************************************************/
+/*
+    available()
+
+    Returns true if new raw data was received since last call
+
+    NOTE:
+    - flag is read & cleared in critical section, so notification set
+      by the timer between the read & the clear isn't lost
+*/
+/**************************************************************************/
+bool MAX6675Background::available(void)
+{
+  bool available = false;
+
+  MAX6675_BACKGROUND_LOCK(this);
+
+  available  = _available;
+  _available = false;
+
+  MAX6675_BACKGROUND_UNLOCK(this);
+
+  return available;
+}
+
+/**************************************************************************/
+/*
+    service()
+
+    Reads the bank if timerInterrupt() requested it, returns true if the
+    read was done, call it as often as possible from the loop()
+
+    NOTE:
+    - read is done outside of interrupt, so it never breaks SPI transaction
+      of SD card, display, etc. on the same bus
+    - conversion is done when timer fires, so the read never blocks
+    - does nothing if timer calls timerHandler() directly, ESP8266 & AVR
+*/
+/**************************************************************************/
+bool MAX6675Background::service(void)
+{
+  bool readPending = false;
+
+  MAX6675_BACKGROUND_LOCK(this);
+
+  readPending  = _readPending;
+  _readPending = false;
+
+  MAX6675_BACKGROUND_UNLOCK(this);
+
+  if (readPending != true) return false;
+
+  timerHandler();
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    getRawData()
+
+    Returns last raw data of the channel received in background,
+    MAX6675_NO_DATA if channel doesn't exist or has never been read
+
+    NOTE:
+    - 16-bit read isn't atomic on 8-bit AVR, so interrupts are disabled
+      during the copy & previous state is restored, it may be called
+      from the callback inside timer interrupt
+*/
+/**************************************************************************/
+uint16_t MAX6675Background::getRawData(uint8_t channel)
+{
+  uint16_t rawData = MAX6675_NO_DATA;
+
+  if (channel >= MAX6675_BANK_MAX_SENSORS) return MAX6675_NO_DATA;
+
+  #if defined(__AVR__)
+  uint8_t oldSREG = SREG;
+
+  cli();
+  #endif
+
+  rawData = _rawData[channel];
+
+  #if defined(__AVR__)
+  SREG = oldSREG;
+  #endif
+
+  return rawData;
+}
+
+/**************************************************************************/
+/*
+    timerHandler()
+
+    Reads all sensors of the bank if conversion is done & delivers results,
+    called by built-in timer on ESP8266 & AVR or by service()
+
+    NOTE:
+    - CS of every sensor goes high after the read & initiates next conversion,
+      so next call after MAX6675_BACKGROUND_PERIOD always finds data ready
+    - makes full SPI transactions, call it from interrupt only if no other
+      device shares the bus or SPI.usingInterrupt() masks the interrupt,
+      otherwise use timerInterrupt() & service()
+*/
+/**************************************************************************/
+void MAX6675Background::timerHandler(void)
+{
+  MAX6675Background *background = _instance;
+  uint16_t           rawData    = 0;
+  uint32_t           timestamp  = 0;
+
+  if (background == 0) return;
+
+  if (background->_bank->readIfReady() != true) return;
+
+  timestamp = micros();
+
+  for (uint8_t channel = 0; channel < background->_bank->getSensorQnt(); channel++)
+  {
+    rawData = background->_bank->getRawData(channel);
+
+    background->_rawData[channel] = rawData;
+
+    if (background->_ringBuffer != 0) background->_ringBuffer->push(channel, rawData, timestamp);
+
+    if (background->_callback   != 0) background->_callback(channel, rawData);
+  }
+
+  MAX6675_BACKGROUND_LOCK(background);
+
+  background->_available = true;
+
+  MAX6675_BACKGROUND_UNLOCK(background);
+}
+
+/**************************************************************************/
+/*
+    timerInterrupt()
+
+    Requests the read from timer interrupt, read is done by service()
+    from the loop(), called by built-in timer on ESP32 & STM32 or by
+    the user timer interrupt
+
+    NOTE:
+    - doesn't touch the bus, so it is safe while other SPI device
+      is selected
+*/
+/**************************************************************************/
+void MAX6675Background::timerInterrupt(void)
+{
+  MAX6675Background *background = _instance;
+
+  if (background == 0) return;
+
+  background->_readPending = true;
+}
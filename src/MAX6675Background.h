@@ -0,0 +1,114 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675Background reads MAX6675Bank from timer
+   interrupt/task at maximum sampling rate ~4..5Hz & delivers results to the user
+   callback, so the loop() never waits for conversion or SPI.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675Background_h
+#define MAX6675Background_h
+
+/*
+   Unfortunately, you cannot #define something in the sketch & get
+   it in the library, because the Arduino toolchain includes library
+   files & compiles them in advance, not knowing where it will be used.
+
+   - uncomment to use Timer0 compare B interrupt on AVR, Timer0 is already
+     used by millis() & compare B interrupt is free on most boards, but it
+     will conflict with any other library that uses TIMER0_COMPB_vect
+   - uncomment & set timer instance to use HardwareTimer on STM32 core v2.0.0
+     or later, timer must not be used by PWM or any other library, timer
+     interrupt only requests the read & service() does it from the loop(),
+     STM32 SPI can't mask the interrupt during other SPI transactions
+*/
+//#define MAX6675_BACKGROUND_AVR_TIMER0
+//#define MAX6675_BACKGROUND_STM32_TIMER TIM3
+
+#include <MAX6675Bank.h>
+#include <MAX6675RingBuffer.h>
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <esp_timer.h>
+#elif defined(ESP8266)
+extern "C" {
+#include <user_interface.h>
+}
+#endif
+
+#define MAX6675_BACKGROUND_PERIOD (MAX6675_CONVERSION_TIME + 5) //in milliseconds, +5msec so conversion is always done when timer fires
+
+typedef void (*MAX6675Callback)(uint8_t channel, uint16_t rawValue);
+
+
+class MAX6675Background
+{
+  public:
+   MAX6675Background(MAX6675Bank &bank);
+
+          bool     begin(MAX6675Callback callback = 0);
+          void     end(void);
+          void     setRingBuffer(MAX6675RingBuffer &ringBuffer);
+          bool     available(void);
+          uint16_t getRawData(uint8_t channel);
+          bool     service(void);
+   static void     timerHandler(void);
+   static void     timerInterrupt(void);
+
+  private:
+   static MAX6675Background *_instance;
+
+   MAX6675Bank       *_bank;
+   MAX6675Callback    _callback;
+   MAX6675RingBuffer *_ringBuffer;
+   volatile uint16_t  _rawData[MAX6675_BANK_MAX_SENSORS];
+   volatile bool      _available;
+   volatile bool      _readPending;                                  //set by timerInterrupt(), cleared by service()
+
+   #if defined(ESP32)
+   esp_timer_handle_t _timer;                                        //esp_timer task only requests the read, see service()
+   portMUX_TYPE       _lock;                                         //esp_timer task may run on the other core
+   #elif defined(ESP8266)
+   os_timer_t         _timer;
+   #endif
+};
+
+#endif
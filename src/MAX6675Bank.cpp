@@ -0,0 +1,294 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675Bank starts conversion of all sensors at
+   the same time & reads them back-to-back, so every sensor keeps maximum sampling
+   rate ~4..5Hz no matter how many sensors are attached.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX6675Bank.h>
+
+
+/**************************************************************************/
+/*
+    MAX6675Bank()
+
+    Constructor for bank of sensors sharing one SPI bus
+
+    NOTE:
+    - add sensors with addSensor(), every sensor keeps its own CS pin
+*/
+/**************************************************************************/
+MAX6675Bank::MAX6675Bank(void)
+{
+  _sensorQnt = 0;
+}
+
+/**************************************************************************/
+/*
+    addSensor()
+
+    Adds sensor to the bank, returns false if the bank is full
+
+    NOTE:
+    - call sensor begin() before adding, bank doesn't configure pins
+    - sensor index in the bank is the channel number, 0..MAX6675_BANK_MAX_SENSORS-1
+*/
+/**************************************************************************/
+bool MAX6675Bank::addSensor(MAX6675 &sensor)
+{
+  if (_sensorQnt >= MAX6675_BANK_MAX_SENSORS) return false;
+
+  _sensor[_sensorQnt]  = &sensor;
+  _rawData[_sensorQnt] = MAX6675_NO_DATA;
+
+  _sensorQnt++;
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    getSensorQnt()
+
+    Returns qnt. of sensors in the bank
+*/
+/**************************************************************************/
+uint8_t MAX6675Bank::getSensorQnt(void)
+{
+  return _sensorQnt;
+}
+
+/**************************************************************************/
+/*
+    startConversion()
+
+    Aborts current conversion of all sensors & starts a new one at the same
+    moment, doesn't block
+
+    NOTE:
+    - all CS are forced low together, then high together, so all
+      sensors finish conversion after one MAX6675_CONVERSION_TIME
+*/
+/**************************************************************************/
+void MAX6675Bank::startConversion(void)
+{
+  uint32_t conversionStart = 0;
+
+  for (uint8_t i = 0; i < _sensorQnt; i++) digitalWrite(_sensor[i]->_cs, LOW);  //stop  measurement/conversion
+
+  delayMicroseconds(1);                                                         //4MHz  is 0.25μsec, do we need it???
+
+  for (uint8_t i = 0; i < _sensorQnt; i++) digitalWrite(_sensor[i]->_cs, HIGH); //start measurement/conversion
+
+  conversionStart = micros();
+
+  for (uint8_t i = 0; i < _sensorQnt; i++)
+  {
+    _sensor[i]->_conversionStart = conversionStart;
+    _sensor[i]->_state           = MAX6675_STATE_CONVERTING;
+  }
+}
+
+/**************************************************************************/
+/*
+    isReady()
+
+    Returns true if conversion of all sensors is done
+*/
+/**************************************************************************/
+bool MAX6675Bank::isReady(void)
+{
+  if (_sensorQnt == 0) return false;
+
+  for (uint8_t i = 0; i < _sensorQnt; i++)
+  {
+    if (_sensor[i]->isReady() != true) return false;
+  }
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    readIfReady()
+
+    Reads raw data of all sensors back-to-back if conversion is done,
+    returns true on success, doesn't block
+
+    NOTE:
+    - CS of every sensor goes high at the end of the read & initiates
+      next conversion, see getRawData()
+*/
+/**************************************************************************/
+bool MAX6675Bank::readIfReady(void)
+{
+  if (isReady() != true) return false;
+
+  for (uint8_t i = 0; i < _sensorQnt; i++)
+  {
+    _sensor[i]->readIfReady(_rawData[i]);
+  }
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    poll()
+
+    Non-blocking state machine, call it as often as possible from the loop(),
+    returns true when new raw data of all sensors is available
+
+    NOTE:
+    - conversion of all sensors is restarted together if any sensor is idle
+*/
+/**************************************************************************/
+bool MAX6675Bank::poll(void)
+{
+  for (uint8_t i = 0; i < _sensorQnt; i++)
+  {
+    if (_sensor[i]->_state == MAX6675_STATE_IDLE)
+    {
+      startConversion();
+
+      return false;
+    }
+  }
+
+  return readIfReady();
+}
+
+/**************************************************************************/
+/*
+    readRawData()
+
+    Starts new conversion of all sensors & reads raw data, blocks
+    for one MAX6675_CONVERSION_TIME no matter how many sensors are
+    in the bank, see getRawData()
+*/
+/**************************************************************************/
+void MAX6675Bank::readRawData(void)
+{
+  if (_sensorQnt == 0) return;
+
+  startConversion();
+
+  while (readIfReady() != true)
+  {
+    yield();                                                                    //prevents ESP8266/ESP32 watchdog reset
+  }
+}
+
+/**************************************************************************/
+/*
+    getRawData()
+
+    Returns last raw data of the channel, MAX6675_NO_DATA if channel
+    doesn't exist or has never been read
+*/
+/**************************************************************************/
+uint16_t MAX6675Bank::getRawData(uint8_t channel)
+{
+  if (channel >= _sensorQnt) return MAX6675_NO_DATA;
+
+  return _rawData[channel];
+}
+
+/**************************************************************************/
+/*
+    getReading()
+
+    Returns last raw data of the channel decoded in one pass,
+    see MAX6675::decodeRawData() for details
+
+    NOTE:
+    - idValid is false if channel doesn't exist or has never been read
+*/
+/**************************************************************************/
+MAX6675Reading MAX6675Bank::getReading(uint8_t channel)
+{
+  return MAX6675::decodeRawData(getRawData(channel));
+}
+
+/**************************************************************************/
+/*
+    getTemperatureFixed()
+
+    Returns last temperature of the channel as fixed-point integer &
+    status, see MAX6675::getTemperatureFixed() for details
+
+    NOTE:
+    - returns MAX6675_ID_ERROR if channel doesn't exist or has never been read
+    - stored raw data is decoded by static MAX6675::decodeTemperatureFixed(),
+      instance getter treats MAX6675_FORCE_READ_DATA as request for new
+      blocking read
+*/
+/**************************************************************************/
+uint8_t MAX6675Bank::getTemperatureFixed(uint8_t channel, int16_t &temperature, uint8_t fractionBits)
+{
+  if (channel >= _sensorQnt)
+  {
+    temperature = 0;
+
+    return MAX6675_ID_ERROR;
+  }
+
+  return MAX6675::decodeTemperatureFixed(temperature, _rawData[channel], fractionBits);
+}
+
+/**************************************************************************/
+/*
+    getTemperature()
+
+    Returns last temperature of the channel, °C
+
+    NOTE:
+    - returns MAX6675_ERROR if channel doesn't exist or has never been read,
+      see MAX6675::getTemperature() for details
+    - never reads the sensor, see getTemperatureFixed()
+*/
+/**************************************************************************/
+float MAX6675Bank::getTemperature(uint8_t channel)
+{
+  if (channel >= _sensorQnt) return MAX6675_ERROR;
+
+  return MAX6675::decodeTemperature(_rawData[channel]);
+}
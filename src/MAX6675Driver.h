@@ -0,0 +1,227 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation with maximum sampling rate ~4..5Hz. MAX6675Driver
+   is header-only template, bus transport is template parameter, so there is no
+   virtual call & read + decode path can be inlined.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675Driver_h
+#define MAX6675Driver_h
+
+#include <MAX6675.h>                               //transports are in MAX6675Transport.h, shared with MAX6675 & MAX6675Soft
+
+
+template <class TRANSPORT>
+class MAX6675Driver
+{
+  public:
+/**************************************************************************/
+/*
+    MAX6675Driver()
+
+    Constructors, arguments are passed to the transport
+
+    NOTE:
+    - MAX6675HwDriver sensor(cs)
+    - MAX6675SoftDriver sensor(cs, so, sck)
+    - MAX6675FastDriver<cs, so, sck> sensor
+    - constructor of the template class is compiled only if it is used,
+      so transport needs only the constructor that matches, implicit
+      copy constructor copies the driver
+*/
+/**************************************************************************/
+   MAX6675Driver(void) : _state(MAX6675_STATE_IDLE), _freeRunning(false), _conversionStart(0), _lastRawData(0)
+   {
+   }
+
+   explicit MAX6675Driver(uint8_t cs) : _transport(cs), _state(MAX6675_STATE_IDLE), _freeRunning(false), _conversionStart(0), _lastRawData(0)
+   {
+   }
+
+   MAX6675Driver(uint8_t cs, uint8_t so, uint8_t sck) : _transport(cs, so, sck), _state(MAX6675_STATE_IDLE), _freeRunning(false), _conversionStart(0), _lastRawData(0)
+   {
+   }
+
+   void begin(void)
+   {
+     _transport.begin();
+
+     _conversionStart = micros();
+     _state           = MAX6675_STATE_CONVERTING;
+   }
+
+   void setFreeRunning(bool enable)
+   {
+     _freeRunning = enable;
+   }
+
+   void startConversion(void)
+   {
+     _transport.pulseCS();
+
+     _conversionStart = micros();
+     _state           = MAX6675_STATE_CONVERTING;
+   }
+
+   bool isReady(void)
+   {
+     if (_state != MAX6675_STATE_CONVERTING) return false;
+
+     return ((micros() - _conversionStart) >= ((uint32_t)MAX6675_CONVERSION_TIME * 1000));
+   }
+
+   bool readIfReady(uint16_t &rawValue)
+   {
+     if (isReady() != true) return false;
+
+     rawValue         = _transport.transfer();
+     _lastRawData     = rawValue;
+
+     _conversionStart = micros();                //CS is high again & new conversion is in progress
+
+     return true;
+   }
+
+   bool poll(void)
+   {
+     uint16_t rawData = 0;
+
+     if (_state != MAX6675_STATE_CONVERTING)
+     {
+       startConversion();
+
+       return false;
+     }
+
+     return readIfReady(rawData);
+   }
+
+   uint16_t getLastRawData(void)
+   {
+     return _lastRawData;
+   }
+
+   MAX6675Reading read(void)
+   {
+     return MAX6675::decodeRawData(readRawData());
+   }
+
+/**************************************************************************/
+/*
+    detectThermocouple(), getChipID(), getTemperatureFixed(), getTemperature()
+
+    Read raw data if rawValue isn't given & decode it with shared inline
+    helpers, see MAX6675::decodeTemperatureFixed() for details
+*/
+/**************************************************************************/
+   bool detectThermocouple(uint16_t rawValue = MAX6675_FORCE_READ_DATA)
+   {
+     if (rawValue == MAX6675_FORCE_READ_DATA) rawValue = readRawData();
+
+     return (MAX6675::decodeStatus(rawValue) == MAX6675_NO_ERROR);
+   }
+
+   uint16_t getChipID(uint16_t rawValue = MAX6675_FORCE_READ_DATA)
+   {
+     if (rawValue == MAX6675_FORCE_READ_DATA) rawValue = readRawData();
+
+     if (MAX6675::decodeStatus(rawValue) != MAX6675_ID_ERROR) return MAX6675_ID;
+
+     return 0;
+   }
+
+   uint8_t getTemperatureFixed(int16_t &temperature, uint16_t rawValue = MAX6675_FORCE_READ_DATA, uint8_t fractionBits = MAX6675_FRACTION_BITS)
+   {
+     if (rawValue == MAX6675_FORCE_READ_DATA) rawValue = readRawData();
+
+     return MAX6675::decodeTemperatureFixed(temperature, rawValue, fractionBits);
+   }
+
+   float getTemperature(uint16_t rawValue = MAX6675_FORCE_READ_DATA)
+   {
+     if (rawValue == MAX6675_FORCE_READ_DATA) rawValue = readRawData();
+
+     return MAX6675::decodeTemperature(rawValue);
+   }
+
+/**************************************************************************/
+/*
+    readRawData()
+
+    Starts new conversion & reads raw data from MAX6675, blocks
+    for MAX6675_CONVERSION_TIME, see MAX6675::readRawData() for details
+*/
+/**************************************************************************/
+   uint16_t readRawData(void)
+   {
+     uint16_t rawData = 0;
+
+     if ((_freeRunning != true) || (_state != MAX6675_STATE_CONVERTING)) startConversion();
+
+     while (readIfReady(rawData) != true)
+     {
+       yield();                                  //prevents ESP8266/ESP32 watchdog reset
+     }
+
+     return rawData;
+   }
+
+   TRANSPORT &getTransport(void)
+   {
+     return _transport;
+   }
+
+  private:
+   TRANSPORT _transport;
+   uint8_t   _state;
+   bool      _freeRunning;
+   uint32_t  _conversionStart; //in microseconds, time when CS was forced high
+   uint16_t  _lastRawData;
+};
+
+
+typedef MAX6675Driver<MAX6675HardwareSPI>                  MAX6675HwDriver;
+typedef MAX6675Driver<MAX6675SoftSPI<MAX6675DigitalPins> > MAX6675SoftDriver;
+
+template <uint8_t CS, uint8_t SO, uint8_t SCK, uint8_t SCK_DELAY = MAX6675_SOFT_SCK_DELAY>
+using MAX6675FastDriver = MAX6675Driver<MAX6675SoftSPI<MAX6675FastPins<CS, SO, SCK>, SCK_DELAY> >;
+
+#endif
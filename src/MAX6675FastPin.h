@@ -0,0 +1,111 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675FastPin resolves pin number into port
+   address & bitmask at compile time, every pin write compiles into single
+   instruction port operation.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675FastPin_h
+#define MAX6675FastPin_h
+
+#if defined(ARDUINO) && ((ARDUINO) >= 100) //arduino core v1.0 or later
+#include <Arduino.h>
+#else
+#include <WProgram.h>
+#endif
+
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega168__) || \
+    defined(__AVR_ATmega168P__) || defined(__AVR_ATmega88__)  || defined(__AVR_ATmega48__)
+#define MAX6675_SOFT_FAST_PINMAP_328                //Uno, Nano, Pro Mini pin mapping, PORTD=0..7, PORTB=8..13, PORTC=14..19
+#endif
+
+#define MAX6675_FAST_IO(address) (*(volatile uint8_t *)(uintptr_t)(address))
+
+
+template <uint8_t PIN>
+class MAX6675FastPin
+{
+  public:
+/**************************************************************************/
+/*
+    write()
+
+    Sets pin state
+
+    NOTE:
+    - on ATmega48/88/168/328 pin number is converted to port address & bit
+      at compile time, every write compiles into single sbi/cbi instruction
+      & every read into single sbic/sbis instruction
+    - on other boards digitalWrite()/digitalRead() with constant pin is used
+*/
+/**************************************************************************/
+   #if defined(MAX6675_SOFT_FAST_PINMAP_328)
+   static_assert(PIN < 20, "MAX6675FastPin: pin number must be 0..19");
+
+   static inline void write(uint8_t value) __attribute__((always_inline))
+   {
+     if (value == LOW) MAX6675_FAST_IO(_pinAddress() + 2) &= ~_pinMask(); //cbi, atomic
+     else              MAX6675_FAST_IO(_pinAddress() + 2) |=  _pinMask(); //sbi, atomic
+   }
+
+   static inline uint8_t read(void) __attribute__((always_inline))
+   {
+     return ((MAX6675_FAST_IO(_pinAddress()) & _pinMask()) != 0);
+   }
+
+  private:
+   /* memory mapped address of PINx register, DDRx = PINx + 1, PORTx = PINx + 2 */
+   static constexpr uint8_t _pinAddress(void) {return (PIN < 8) ? 0x29 : ((PIN < 14) ? 0x23 : 0x26);} //PIND, PINB, PINC
+   static constexpr uint8_t _pinMask(void)    {return (PIN < 8) ? (1 << PIN) : ((PIN < 14) ? (1 << (PIN - 8)) : (1 << (PIN - 14)));}
+   #else
+   static inline void write(uint8_t value) __attribute__((always_inline))
+   {
+     digitalWrite(PIN, value);
+   }
+
+   static inline uint8_t read(void) __attribute__((always_inline))
+   {
+     return digitalRead(PIN);
+   }
+   #endif
+};
+
+#endif
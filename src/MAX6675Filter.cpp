@@ -0,0 +1,289 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. Streaming filters update in O(1) per sample with
+   integer math only & keep constant memory per channel, filtered value is ready
+   at any time without recalculation.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX6675Filter.h>
+
+
+/**************************************************************************/
+/*
+    MAX6675EMA()
+
+    Constructor for exponential moving average
+
+    NOTE:
+    - shift is smoothing factor, alpha = 1/2^shift, 0..15
+      - 1 fast response, light smoothing
+      - 3 (default) time constant ~8 samples, ~1.8sec at 4.5Hz
+      - 5 time constant ~32 samples, ~7sec at 4.5Hz
+*/
+/**************************************************************************/
+MAX6675EMA::MAX6675EMA(uint8_t shift)
+{
+  _shift = (shift > 15) ? 15 : shift;
+
+  reset();
+}
+
+/**************************************************************************/
+/*
+    update()
+
+    Adds raw data to the filter, returns false & ignores the sample
+    if thermocouple is open or chip ID is wrong
+
+    NOTE:
+    - the first sample initializes the state, so there is no ramp from 0
+*/
+/**************************************************************************/
+bool MAX6675EMA::update(uint16_t rawValue)
+{
+  MAX6675Reading reading = MAX6675::decodeRawData(rawValue);
+  int32_t        sample  = 0;
+
+  if ((reading.idValid != true) || (reading.thermocoupleOpen == true)) return false;
+
+  sample = (int32_t)reading.temperature << MAX6675_EMA_FRACTION_BITS;
+
+  if (_sampleQnt == 0) _state  = sample;
+  else                 _state += (sample - _state) / ((int32_t)1 << _shift); //division by power of two is a shift & rounds to zero for both signs
+
+  if (_sampleQnt < 0xFF) _sampleQnt++;
+
+  _value = (int16_t)((_state + ((int32_t)1 << (MAX6675_EMA_FRACTION_BITS - 1))) >> MAX6675_EMA_FRACTION_BITS);
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    getValue()
+
+    Returns filtered temperature in quarter-degrees, 0 if no samples
+*/
+/**************************************************************************/
+int16_t MAX6675EMA::getValue(void)
+{
+  return _value;
+}
+
+/**************************************************************************/
+/*
+    getSampleQnt()
+
+    Returns qnt. of accepted samples, saturates at 255
+*/
+/**************************************************************************/
+uint8_t MAX6675EMA::getSampleQnt(void)
+{
+  return _sampleQnt;
+}
+
+/**************************************************************************/
+/*
+    reset()
+
+    Clears the filter
+*/
+/**************************************************************************/
+void MAX6675EMA::reset(void)
+{
+  _state     = 0;
+  _sampleQnt = 0;
+  _value     = 0;
+}
+
+
+/**************************************************************************/
+/*
+    MAX6675MedianFilter()
+
+    Constructor for median of 3 with spike rejection
+
+    NOTE:
+    - maxStep is max difference from the current median in quarter-degrees,
+      e.g. 40 is 10°C, 0 (default) disables rejection
+    - rejection starts after 3 samples, so the filter can't lock
+      on a wrong first sample
+    - MAX6675_MEDIAN_MAX_REJECTS rejects in a row re-seed the window,
+      so the filter can't lock on the old temperature after a real step
+*/
+/**************************************************************************/
+MAX6675MedianFilter::MAX6675MedianFilter(uint16_t maxStep)
+{
+  _maxStep = maxStep;
+
+  reset();
+}
+
+/**************************************************************************/
+/*
+    update()
+
+    Adds raw data to the filter, returns false & ignores the sample
+    if thermocouple is open, chip ID is wrong or the sample is a spike
+
+    NOTE:
+    - open thermocouple or ID error clears the window, so the samples
+      after reconnect aren't compared with the median before it
+*/
+/**************************************************************************/
+bool MAX6675MedianFilter::update(uint16_t rawValue)
+{
+  MAX6675Reading reading = MAX6675::decodeRawData(rawValue);
+  int16_t        a       = 0;
+  int16_t        b       = 0;
+  int16_t        c       = 0;
+
+  if ((reading.idValid != true) || (reading.thermocoupleOpen == true))
+  {
+    _index     = 0;                                 //restart the window, keep the last value
+    _sampleQnt = 0;
+    _rejectRun = 0;
+
+    return false;
+  }
+
+  if ((_maxStep != 0) && (_sampleQnt >= 3))
+  {
+    int16_t step = reading.temperature - _value;
+
+    if ((step > (int16_t)_maxStep) || (-step > (int16_t)_maxStep))
+    {
+      if (_rejectedQnt < 0xFFFF) _rejectedQnt++;
+
+      if (++_rejectRun < MAX6675_MEDIAN_MAX_REJECTS) return false;
+
+      _index     = 0;                               //real step, re-seed the window from this sample
+      _sampleQnt = 0;
+    }
+  }
+
+  _rejectRun = 0;
+
+  _sample[_index] = reading.temperature;
+
+  if (++_index >= 3) _index = 0;
+  if (_sampleQnt < 3) _sampleQnt++;
+
+  switch (_sampleQnt)
+  {
+    case 1:
+      _value = _sample[0];
+      break;
+
+    case 2:
+      _value = (_sample[0] + _sample[1] + 1) >> 1;  //not enough samples for median, average of 2
+      break;
+
+    default:
+      a = _sample[0];
+      b = _sample[1];
+      c = _sample[2];
+
+      if (a > b) {int16_t t = a; a = b; b = t;}     //3 element sorting network, b is median
+      if (b > c) {b = c;}
+      if (a > b) {b = a;}
+
+      _value = b;
+      break;
+  }
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    getValue()
+
+    Returns filtered temperature in quarter-degrees, 0 if no samples
+*/
+/**************************************************************************/
+int16_t MAX6675MedianFilter::getValue(void)
+{
+  return _value;
+}
+
+/**************************************************************************/
+/*
+    getSampleQnt()
+
+    Returns qnt. of samples in the window, 0..3
+*/
+/**************************************************************************/
+uint8_t MAX6675MedianFilter::getSampleQnt(void)
+{
+  return _sampleQnt;
+}
+
+/**************************************************************************/
+/*
+    getRejectedQnt()
+
+    Returns qnt. of rejected spikes, saturates at 65535
+*/
+/**************************************************************************/
+uint16_t MAX6675MedianFilter::getRejectedQnt(void)
+{
+  return _rejectedQnt;
+}
+
+/**************************************************************************/
+/*
+    reset()
+
+    Clears the filter
+*/
+/**************************************************************************/
+void MAX6675MedianFilter::reset(void)
+{
+  _sample[0]   = 0;
+  _sample[1]   = 0;
+  _sample[2]   = 0;
+  _rejectedQnt = 0;
+  _index       = 0;
+  _sampleQnt   = 0;
+  _rejectRun   = 0;
+  _value       = 0;
+}
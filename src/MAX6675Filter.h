@@ -0,0 +1,190 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. Streaming filters update in O(1) per sample with
+   integer math only & keep constant memory per channel, filtered value is ready
+   at any time without recalculation.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675Filter_h
+#define MAX6675Filter_h
+
+#include <MAX6675.h>
+
+#define MAX6675_EMA_FRACTION_BITS  8 //extra fractional bits of EMA state, keeps small steps from being lost
+#define MAX6675_MEDIAN_MAX_REJECTS 3 //consecutive rejected samples that are taken as a real step & re-seed the median
+
+
+/*
+   Moving average of last WINDOW samples
+
+   - sum is updated by adding new & subtracting the oldest sample, O(1)
+   - memory is WINDOW * 2 + 8 bytes
+*/
+template <uint8_t WINDOW>
+class MAX6675MovingAverage
+{
+  static_assert(WINDOW > 0, "MAX6675MovingAverage WINDOW must be 1..255");
+
+  public:
+   MAX6675MovingAverage(void)
+   {
+     reset();
+   }
+
+/**************************************************************************/
+/*
+    update()
+
+    Adds raw data to the filter, returns false & ignores the sample
+    if thermocouple is open or chip ID is wrong
+*/
+/**************************************************************************/
+   bool update(uint16_t rawValue)
+   {
+     MAX6675Reading reading = MAX6675::decodeRawData(rawValue);
+
+     if ((reading.idValid != true) || (reading.thermocoupleOpen == true)) return false;
+
+     _sum                 += (uint16_t)reading.temperature;
+     _sum                 -= _sample[_index];
+     _sample[_index]       = reading.temperature;
+
+     if (++_index >= WINDOW) _index = 0;
+     if (_sampleQnt < WINDOW) _sampleQnt++;
+
+     _value = (int16_t)((_sum + (_sampleQnt >> 1)) / _sampleQnt); //rounded average of available samples
+
+     return true;
+   }
+
+/**************************************************************************/
+/*
+    getValue()
+
+    Returns filtered temperature in quarter-degrees, 0 if no samples
+*/
+/**************************************************************************/
+   int16_t getValue(void)
+   {
+     return _value;
+   }
+
+   uint8_t getSampleQnt(void)
+   {
+     return _sampleQnt;
+   }
+
+   void reset(void)
+   {
+     for (uint8_t i = 0; i < WINDOW; i++) _sample[i] = 0;
+
+     _sum       = 0;
+     _index     = 0;
+     _sampleQnt = 0;
+     _value     = 0;
+   }
+
+  private:
+   uint16_t _sample[WINDOW];
+   uint32_t _sum;
+   uint8_t  _index;
+   uint8_t  _sampleQnt;
+   int16_t  _value;
+};
+
+
+/*
+   Exponential moving average, y += (x - y) / 2^shift
+
+   - division is a shift, time constant is ~2^shift samples
+   - memory is 8 bytes
+*/
+class MAX6675EMA
+{
+  public:
+   MAX6675EMA(uint8_t shift = 3);
+
+   bool    update(uint16_t rawValue);
+   int16_t getValue(void);
+   uint8_t getSampleQnt(void);
+   void    reset(void);
+
+  private:
+   int32_t _state;                                       //quarter-degrees << MAX6675_EMA_FRACTION_BITS
+   uint8_t _shift;
+   uint8_t _sampleQnt;
+   int16_t _value;
+};
+
+
+/*
+   Median of last 3 samples with spike rejection
+
+   - single sample spike is always removed by median
+   - sample that differs from the median by more than maxStep is rejected
+     & isn't stored, 0 disables rejection
+   - MAX6675_MEDIAN_MAX_REJECTS rejects in a row are a real step, e.g. heater
+     turned on, & the window is re-seeded from the new sample
+   - open thermocouple or ID error restarts the window, last value is kept
+   - memory is 13 bytes
+*/
+class MAX6675MedianFilter
+{
+  public:
+   MAX6675MedianFilter(uint16_t maxStep = 0);
+
+   bool     update(uint16_t rawValue);
+   int16_t  getValue(void);
+   uint8_t  getSampleQnt(void);
+   uint16_t getRejectedQnt(void);
+   void     reset(void);
+
+  private:
+   int16_t  _sample[3];
+   uint16_t _maxStep;
+   uint16_t _rejectedQnt;
+   uint8_t  _index;
+   uint8_t  _sampleQnt;
+   uint8_t  _rejectRun;                                  //consecutive rejected samples
+   int16_t  _value;
+};
+
+#endif
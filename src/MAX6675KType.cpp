@@ -0,0 +1,154 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675KType corrects K-type thermocouple
+   nonlinearity & cold junction error with PROGMEM lookup table, one table read
+   & one multiply-add per reading, see extras/tools/max6675_ktype_table.py
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX6675KType.h>
+#include <MAX6675KTypeTable.h>
+
+#define MAX6675_KTYPE_MAX_CODE ((((int32_t)MAX6675_KTYPE_POINTS - 1) << (MAX6675_KTYPE_SEGMENT_BITS + MAX6675_KTYPE_CODE_FRACTION_BITS)) - 1) //last point is only interpolated to
+
+
+/**************************************************************************/
+/*
+    linearize()
+
+    Converts 12-bit temperature code D14..D3 into true K-type thermocouple
+    temperature, returns °C * 16
+
+    NOTE:
+    - MAX6675 assumes linear thermocouple with 41.276μV/°C, error is up
+      to ~4°C around 300°C & it is not the same for every range
+    - MAX6675 compensates cold junction linearly too, true voltage of
+      the cold junction is added as offset from PROGMEM table, so the
+      result depends on cold junction temperature ~1°C over -20°C..+85°C
+    - coldJunction is temperature of MAX6675 & thermocouple terminals in °C,
+      it is limited to -20°C..+85°C
+    - corrected code in 1/16 steps selects table segment by high bits,
+      low bits interpolate between two points, one multiply-add
+    - without MAX6675_KTYPE_INTERPOLATE code is rounded to nearest point
+    - table & max error are in MAX6675KTypeTable.h, 130 points & 0.1°C
+      by default, regenerate it for other size/accuracy
+*/
+/**************************************************************************/
+int16_t MAX6675KType::linearize(uint16_t code, int8_t coldJunction)
+{
+  int32_t  codeFixed = 0;
+  uint16_t segment   = 0;
+  int16_t  point     = 0;
+
+  if      (coldJunction < MAX6675_KTYPE_CJ_MIN) coldJunction = MAX6675_KTYPE_CJ_MIN;
+  else if (coldJunction > MAX6675_KTYPE_CJ_MAX) coldJunction = MAX6675_KTYPE_CJ_MAX;
+
+  codeFixed = ((int32_t)(code & 0x0FFF) << MAX6675_KTYPE_CODE_FRACTION_BITS) + (int8_t)pgm_read_byte(&max6675KTypeColdJunction[coldJunction - MAX6675_KTYPE_CJ_MIN]);
+
+  if      (codeFixed < 0)                      codeFixed = 0;                      //chip can't measure below 0°C
+  else if (codeFixed > MAX6675_KTYPE_MAX_CODE) codeFixed = MAX6675_KTYPE_MAX_CODE;
+
+  #ifdef MAX6675_KTYPE_INTERPOLATE
+  segment = codeFixed >> (MAX6675_KTYPE_SEGMENT_BITS + MAX6675_KTYPE_CODE_FRACTION_BITS);
+  point   = (int16_t)pgm_read_word(&max6675KTypeTable[segment]);
+
+  uint16_t fraction = codeFixed & ((1 << (MAX6675_KTYPE_SEGMENT_BITS + MAX6675_KTYPE_CODE_FRACTION_BITS)) - 1);
+  int16_t  slope    = (int16_t)pgm_read_word(&max6675KTypeTable[segment + 1]) - point;
+
+  point += ((int32_t)slope * fraction) >> (MAX6675_KTYPE_SEGMENT_BITS + MAX6675_KTYPE_CODE_FRACTION_BITS);
+  #else
+  segment = (codeFixed + (1 << (MAX6675_KTYPE_SEGMENT_BITS + MAX6675_KTYPE_CODE_FRACTION_BITS - 1))) >> (MAX6675_KTYPE_SEGMENT_BITS + MAX6675_KTYPE_CODE_FRACTION_BITS); //round to nearest point, last point exists
+  point   = (int16_t)pgm_read_word(&max6675KTypeTable[segment]);
+  #endif
+
+  return point;
+}
+
+/**************************************************************************/
+/*
+    getTemperatureFixed()
+
+    Decodes raw data & returns linearized temperature as fixed-point
+    integer, returns status
+
+    NOTE:
+    - rawValue is data from MAX6675::readRawData(), MAX6675Bank, etc.
+    - fractionBits is qnt. of fractional bits, temperature = °C * 2^fractionBits
+      - 2 (default) quarter-degrees, same as MAX6675::getTemperatureFixed()
+      - 4 1/16 degrees, table resolution
+      - values above MAX6675_KTYPE_MAX_FRACTION_BITS are limited to it
+    - status, see MAX6675::getTemperatureFixed()
+    - temperature is set to 0 if status isn't MAX6675_NO_ERROR
+*/
+/**************************************************************************/
+uint8_t MAX6675KType::getTemperatureFixed(int16_t &temperature, uint16_t rawValue, int8_t coldJunction, uint8_t fractionBits)
+{
+  uint8_t status = MAX6675::decodeStatus(rawValue);
+
+  temperature = 0;
+
+  if (status != MAX6675_NO_ERROR) return status;
+
+  if (fractionBits > MAX6675_KTYPE_MAX_FRACTION_BITS) fractionBits = MAX6675_KTYPE_MAX_FRACTION_BITS;
+
+  temperature = linearize((rawValue >> 3) & 0x0FFF, coldJunction) >> (MAX6675_KTYPE_TEMP_FRACTION_BITS - fractionBits);
+
+  return MAX6675_NO_ERROR;
+}
+
+/**************************************************************************/
+/*
+    getTemperature()
+
+    Decodes raw data & returns linearized temperature, °C
+
+    NOTE:
+    - float wrapper over getTemperatureFixed()
+    - returns MAX6675_ERROR if thermocouple is open or chip ID is wrong
+*/
+/**************************************************************************/
+float MAX6675KType::getTemperature(uint16_t rawValue, int8_t coldJunction)
+{
+  int16_t temperature = 0;
+
+  if (getTemperatureFixed(temperature, rawValue, coldJunction, MAX6675_KTYPE_MAX_FRACTION_BITS) != MAX6675_NO_ERROR) return MAX6675_ERROR;
+
+  return (float)temperature / (1 << MAX6675_KTYPE_MAX_FRACTION_BITS);
+}
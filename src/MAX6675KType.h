@@ -0,0 +1,76 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675KType corrects K-type thermocouple
+   nonlinearity & cold junction error with PROGMEM lookup table, one table read
+   & one multiply-add per reading, see extras/tools/max6675_ktype_table.py
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675KType_h
+#define MAX6675KType_h
+
+#include <MAX6675.h>
+
+/*
+   Unfortunately, you cannot #define something in the sketch & get
+   it in the library, because the Arduino toolchain includes library
+   files & compiles them in advance, not knowing where it will be used.
+
+   - comment out to return nearest table point without interpolation, use it only
+     with table generated by "--segment-bits 0", see extras/tools/max6675_ktype_table.py
+   - cold junction temperature in °C if it isn't measured, MAX6675 die temperature
+*/
+#define MAX6675_KTYPE_INTERPOLATE
+#ifndef MAX6675_KTYPE_COLD_JUNCTION
+#define MAX6675_KTYPE_COLD_JUNCTION 25
+#endif
+
+#define MAX6675_KTYPE_MAX_FRACTION_BITS 4 //table resolution is 1/16°C
+
+
+class MAX6675KType
+{
+  public:
+   static int16_t linearize(uint16_t code, int8_t coldJunction = MAX6675_KTYPE_COLD_JUNCTION);
+   static uint8_t getTemperatureFixed(int16_t &temperature, uint16_t rawValue, int8_t coldJunction = MAX6675_KTYPE_COLD_JUNCTION, uint8_t fractionBits = MAX6675_FRACTION_BITS);
+   static float   getTemperature(uint16_t rawValue, int8_t coldJunction = MAX6675_KTYPE_COLD_JUNCTION);
+};
+
+#endif
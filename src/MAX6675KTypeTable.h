@@ -0,0 +1,49 @@
+/***************************************************************************************************/
+/*
+   K-type linearization & cold junction correction tables for MAX6675KType
+
+   generated by extras/tools/max6675_ktype_table.py --segment-bits 5, don't edit
+   NIST ITS-90 type K reference function, max interpolation error 0.096 C
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675KTypeTable_h
+#define MAX6675KTypeTable_h
+
+#define MAX6675_KTYPE_SEGMENT_BITS       5     //log2 of codes per table segment
+#define MAX6675_KTYPE_POINTS             130   //temperature table size
+#define MAX6675_KTYPE_CODE_FRACTION_BITS 4     //cold junction offset is in 1/16 code
+#define MAX6675_KTYPE_TEMP_FRACTION_BITS 4     //temperature table is in 1/16C
+#define MAX6675_KTYPE_CJ_MIN             -20   //cold junction table range, C
+#define MAX6675_KTYPE_CJ_MAX             85
+
+static const int16_t max6675KTypeTable[MAX6675_KTYPE_POINTS] PROGMEM =
+{
+       0,    133,    265,    396,    526,    655,    784,    912,   1039,   1166,   1294,   1421,
+    1548,   1676,   1804,   1933,   2062,   2192,   2323,   2454,   2586,   2718,   2850,   2982,
+    3114,   3247,   3379,   3510,   3642,   3772,   3903,   4033,   4162,   4291,   4420,   4548,
+    4676,   4804,   4931,   5058,   5185,   5311,   5438,   5564,   5690,   5816,   5942,   6067,
+    6193,   6318,   6443,   6568,   6693,   6817,   6942,   7067,   7191,   7315,   7439,   7564,
+    7688,   7812,   7936,   8060,   8184,   8307,   8431,   8555,   8679,   8803,   8927,   9051,
+    9175,   9299,   9423,   9547,   9672,   9796,   9921,  10045,  10170,  10295,  10420,  10545,
+   10670,  10796,  10921,  11047,  11173,  11299,  11426,  11552,  11679,  11806,  11933,  12060,
+   12188,  12316,  12444,  12572,  12701,  12830,  12959,  13088,  13217,  13347,  13477,  13608,
+   13738,  13869,  14000,  14131,  14263,  14395,  14527,  14660,  14792,  14925,  15059,  15192,
+   15326,  15460,  15595,  15730,  15865,  16000,  16136,  16272,  16408,  16545
+};
+
+static const int8_t max6675KTypeColdJunction[MAX6675_KTYPE_CJ_MAX - MAX6675_KTYPE_CJ_MIN + 1] PROGMEM =
+{
+    74,   70,   65,   61,   56,   52,   48,   44,   40,   36,   32,   29,   25,   22,   18,   15,
+    12,    9,    6,    3,    0,   -3,   -6,   -8,  -11,  -13,  -16,  -18,  -20,  -23,  -25,  -27,
+   -29,  -31,  -33,  -34,  -36,  -38,  -39,  -41,  -42,  -44,  -45,  -47,  -48,  -49,  -50,  -51,
+   -52,  -53,  -54,  -55,  -56,  -57,  -57,  -58,  -59,  -59,  -60,  -60,  -61,  -61,  -62,  -62,
+   -62,  -62,  -63,  -63,  -63,  -63,  -63,  -63,  -63,  -63,  -63,  -63,  -63,  -63,  -63,  -62,
+   -62,  -62,  -62,  -61,  -61,  -61,  -60,  -60,  -60,  -59,  -59,  -59,  -58,  -58,  -57,  -57,
+   -57,  -56,  -56,  -55,  -55,  -55,  -54,  -54,  -53,  -53
+};
+
+#endif
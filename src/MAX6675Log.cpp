@@ -0,0 +1,201 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675Log packs samples into small binary blocks
+   with delta encoded values & timestamps for SD card/flash logging, see
+   extras/host/logdump for the block format & host decoder.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX6675Log.h>
+
+
+/**************************************************************************/
+/*
+    MAX6675Log()
+
+    Constructor for packed binary log
+
+    NOTE:
+    - output is any Print, SD File, Serial, etc., blocks are appended
+      to it, so log can be continued after reboot
+*/
+/**************************************************************************/
+MAX6675Log::MAX6675Log(Print &output)
+{
+  _output         = &output;
+  _blockSize      = 0;
+  _blockRecordQnt = 0;
+  _lastTimestamp  = 0;
+  _recordQnt      = 0;
+  _byteQnt        = 0;
+
+  for (uint8_t i = 0; i < MAX6675_LOG_MAX_CHANNELS; i++) _lastValue[i] = 0;
+}
+
+/**************************************************************************/
+/*
+    add()
+
+    Adds sample to the block, returns false if channel doesn't exist
+
+    NOTE:
+    - timestamp in milliseconds, millis() when the sample was read
+    - only bits D14..D1 are stored, D15 is always zero & D0 is three-state
+    - record:
+      - channel, 1 byte
+      - time since previous record in the block, unsigned LEB128 varint,
+        1..2 bytes for 220msec
+      - difference of D14..D1 with previous record of the same channel in
+        the block, zigzag LEB128 varint, 1 byte for change less than ±16°C
+    - first record of every channel in the block is difference with 0, so
+      every block can be decoded on its own
+*/
+/**************************************************************************/
+bool MAX6675Log::add(uint8_t channel, uint16_t rawValue, uint32_t timestamp)
+{
+  uint16_t value = (rawValue >> 1) & 0x3FFF;                        //D14..D1
+  int16_t  delta = 0;
+
+  if (channel >= MAX6675_LOG_MAX_CHANNELS) return false;
+
+  if (_blockSize == 0)                                              //start new block
+  {
+    _blockSize      = MAX6675_LOG_HEADER_SIZE;
+    _blockRecordQnt = 0;
+    _lastTimestamp  = timestamp;
+
+    _block[4] = timestamp;
+    _block[5] = timestamp >> 8;
+    _block[6] = timestamp >> 16;
+    _block[7] = timestamp >> 24;
+
+    for (uint8_t i = 0; i < MAX6675_LOG_MAX_CHANNELS; i++) _lastValue[i] = 0;
+  }
+
+  delta = (int16_t)(value - _lastValue[channel]);                  //-16383..+16383
+
+  _block[_blockSize++] = channel;
+
+  _putVarint(timestamp - _lastTimestamp);                           //unsigned subtraction is roll over safe
+  _putVarint((uint16_t)(((uint16_t)delta << 1) ^ (uint16_t)(delta >> 15))); //zigzag, small positive & negative deltas are small numbers
+
+  _lastTimestamp      = timestamp;
+  _lastValue[channel] = value;
+
+  _blockRecordQnt++;
+  _recordQnt++;
+
+  if (((_blockSize + MAX6675_LOG_MAX_RECORD_SIZE) > MAX6675_LOG_BLOCK_SIZE) || (_blockRecordQnt == 255)) flush(); //next record may not fit
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    flush()
+
+    Writes current block to the output, call it before power off
+    or SD card file close
+
+    NOTE:
+    - block header, little endian:
+      - magic MAX6675_LOG_MAGIC, 2 bytes
+      - qnt. of records, 1 byte
+      - payload size in bytes without header, 1 byte
+      - timestamp of the first record in milliseconds, 4 bytes
+*/
+/**************************************************************************/
+void MAX6675Log::flush(void)
+{
+  if (_blockSize == 0) return;
+
+  _block[0] = MAX6675_LOG_MAGIC & 0xFF;
+  _block[1] = MAX6675_LOG_MAGIC >> 8;
+  _block[2] = _blockRecordQnt;
+  _block[3] = _blockSize - MAX6675_LOG_HEADER_SIZE;
+
+  _byteQnt += _output->write(_block, _blockSize);
+
+  _blockSize = 0;
+}
+
+/**************************************************************************/
+/*
+    getRecordQnt()
+
+    Returns qnt. of samples added since start
+*/
+/**************************************************************************/
+uint32_t MAX6675Log::getRecordQnt(void)
+{
+  return _recordQnt;
+}
+
+/**************************************************************************/
+/*
+    getByteQnt()
+
+    Returns qnt. of bytes written to the output since start
+*/
+/**************************************************************************/
+uint32_t MAX6675Log::getByteQnt(void)
+{
+  return _byteQnt;
+}
+
+/**************************************************************************/
+/*
+    _putVarint()
+
+    Appends unsigned LEB128 varint to the block, 7 bits per byte,
+    low bits first, high bit is set if more bytes follow
+*/
+/**************************************************************************/
+void MAX6675Log::_putVarint(uint32_t value)
+{
+  while (value > 0x7F)
+  {
+    _block[_blockSize++] = (value & 0x7F) | 0x80;
+
+    value >>= 7;
+  }
+
+  _block[_blockSize++] = value;
+}
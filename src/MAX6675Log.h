@@ -0,0 +1,96 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675Log packs samples into small binary blocks
+   with delta encoded values & timestamps for SD card/flash logging, see
+   extras/host/logdump for the block format & host decoder.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675Log_h
+#define MAX6675Log_h
+
+#include <MAX6675.h>
+
+/*
+   Unfortunately, you cannot #define something in the sketch & get
+   it in the library, because the Arduino toolchain includes library
+   files & compiles them in advance, not knowing where it will be used.
+
+   - block size in bytes including header, it is the only RAM buffer of the log,
+     block is written to the output when the next record may not fit
+*/
+#ifndef MAX6675_LOG_BLOCK_SIZE
+#define MAX6675_LOG_BLOCK_SIZE      64
+#endif
+
+#define MAX6675_LOG_MAGIC           0x6675 //first 2 bytes of every block, little endian
+#define MAX6675_LOG_HEADER_SIZE     8      //magic, record qnt., payload size & timestamp
+#define MAX6675_LOG_MAX_RECORD_SIZE 9      //channel + 5 bytes varint dt + 3 bytes zigzag varint delta
+#define MAX6675_LOG_MAX_CHANNELS    8
+
+#if (MAX6675_LOG_BLOCK_SIZE < (MAX6675_LOG_HEADER_SIZE + MAX6675_LOG_MAX_RECORD_SIZE)) || (MAX6675_LOG_BLOCK_SIZE > (MAX6675_LOG_HEADER_SIZE + 255))
+#error "MAX6675_LOG_BLOCK_SIZE must be 17..263 bytes"
+#endif
+
+
+class MAX6675Log
+{
+  public:
+   MAX6675Log(Print &output);
+
+   bool     add(uint8_t channel, uint16_t rawValue, uint32_t timestamp);
+   void     flush(void);
+   uint32_t getRecordQnt(void);
+   uint32_t getByteQnt(void);
+
+  private:
+   Print    *_output;
+   uint8_t   _block[MAX6675_LOG_BLOCK_SIZE];
+   uint16_t  _blockSize;                                  //in bytes, 0 if block isn't started, block may be up to 263 bytes
+   uint8_t   _blockRecordQnt;
+   uint32_t  _lastTimestamp;
+   uint16_t  _lastValue[MAX6675_LOG_MAX_CHANNELS];
+   uint32_t  _recordQnt;
+   uint32_t  _byteQnt;
+
+   void _putVarint(uint32_t value);
+};
+
+#endif
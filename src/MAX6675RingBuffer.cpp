@@ -0,0 +1,237 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675RingBuffer is a lock-free single-producer/
+   single-consumer queue of timestamped raw samples in user allocated static memory,
+   filled by the acquisition path & drained by the application.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX6675RingBuffer.h>
+
+
+/**************************************************************************/
+/*
+    MAX6675RingBuffer()
+
+    Constructor for lock-free single-producer/single-consumer ring buffer
+
+    NOTE:
+    - buffer is allocated by the user, e.g. "static MAX6675Sample buffer[32];"
+      & must live as long as the object, no heap is used
+    - capacity is rounded down to power of two, 1..MAX6675_RING_MAX_CAPACITY,
+      size is 16-bit, so 256 on AVR is limited to 128 & doesn't wrap to 0
+    - head & tail are free-running counters, index in the buffer
+      is "counter & mask", counters roll over safely
+*/
+/**************************************************************************/
+MAX6675RingBuffer::MAX6675RingBuffer(MAX6675Sample *buffer, uint16_t size)
+{
+  uint16_t capacity = 1;
+
+  if (size > MAX6675_RING_MAX_CAPACITY) size = MAX6675_RING_MAX_CAPACITY;
+
+  while (((uint16_t)(capacity << 1) <= size) && (capacity < MAX6675_RING_MAX_CAPACITY)) capacity <<= 1;
+
+  _buffer      = buffer;
+  _mask        = (size == 0) ? 0 : (capacity - 1);
+  _head        = 0;
+  _tail        = 0;
+  _overflowQnt = 0;
+
+  if (size == 0) _buffer = 0;                                         //no storage, every push() fails
+}
+
+/**************************************************************************/
+/*
+    push()
+
+    Adds sample to the buffer, returns false & counts overflow if the buffer
+    is full
+
+    NOTE:
+    - call only from the producer, timer interrupt or acquisition task
+    - the newest sample is dropped on overflow, samples in the buffer
+      are never overwritten while consumer reads them
+    - sample is written before head is published, so consumer never
+      sees half written sample
+*/
+/**************************************************************************/
+bool MAX6675RingBuffer::push(uint8_t channel, uint16_t rawValue, uint32_t timestamp)
+{
+  max6675_index_t head = _head;
+
+  if ((_buffer == 0) || ((max6675_index_t)(head - _tail) > _mask))
+  {
+    _overflowQnt = _overflowQnt + 1;
+
+    return false;
+  }
+
+  _buffer[head & _mask].timestamp = timestamp;
+  _buffer[head & _mask].rawValue  = rawValue;
+  _buffer[head & _mask].channel   = channel;
+
+  MAX6675_MEMORY_BARRIER();                                           //sample must be stored before head is updated
+
+  _head = head + 1;
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    pop()
+
+    Removes the oldest sample from the buffer, returns false if the buffer
+    is empty
+
+    NOTE:
+    - call only from the consumer
+*/
+/**************************************************************************/
+bool MAX6675RingBuffer::pop(MAX6675Sample &sample)
+{
+  return (read(&sample, 1) == 1);
+}
+
+/**************************************************************************/
+/*
+    read()
+
+    Removes up to maxQnt oldest samples from the buffer, returns qnt.
+    of copied samples
+
+    NOTE:
+    - call only from the consumer
+    - tail is published once after the whole block is copied
+*/
+/**************************************************************************/
+max6675_index_t MAX6675RingBuffer::read(MAX6675Sample *samples, max6675_index_t maxQnt)
+{
+  max6675_index_t tail      = _tail;
+  max6675_index_t available = _head - tail;
+
+  MAX6675_MEMORY_BARRIER();                                           //head must be read before samples
+
+  if (available > maxQnt) available = maxQnt;
+
+  for (max6675_index_t i = 0; i < available; i++)
+  {
+    samples[i] = _buffer[(max6675_index_t)(tail + i) & _mask];
+  }
+
+  MAX6675_MEMORY_BARRIER();                                           //samples must be copied before tail is updated
+
+  _tail = tail + available;
+
+  return available;
+}
+
+/**************************************************************************/
+/*
+    available()
+
+    Returns qnt. of samples in the buffer
+*/
+/**************************************************************************/
+max6675_index_t MAX6675RingBuffer::available(void)
+{
+  return (max6675_index_t)(_head - _tail);
+}
+
+/**************************************************************************/
+/*
+    getCapacity()
+
+    Returns max qnt. of samples in the buffer, 0 if no storage
+*/
+/**************************************************************************/
+max6675_index_t MAX6675RingBuffer::getCapacity(void)
+{
+  if (_buffer == 0) return 0;
+
+  return _mask + 1;
+}
+
+/**************************************************************************/
+/*
+    getOverflowQnt()
+
+    Returns qnt. of samples dropped because the buffer was full
+
+    NOTE:
+    - 32-bit read isn't atomic on 8-bit AVR, so interrupts are disabled
+      during the copy & previous state is restored, it may be called
+      from the background callback inside timer interrupt
+*/
+/**************************************************************************/
+uint32_t MAX6675RingBuffer::getOverflowQnt(void)
+{
+  uint32_t overflowQnt = 0;
+
+  #if defined(__AVR__)
+  uint8_t oldSREG = SREG;
+
+  cli();
+  #endif
+
+  overflowQnt = _overflowQnt;
+
+  #if defined(__AVR__)
+  SREG = oldSREG;
+  #endif
+
+  return overflowQnt;
+}
+
+/**************************************************************************/
+/*
+    clear()
+
+    Drops all samples in the buffer
+
+    NOTE:
+    - call only from the consumer, overflow counter isn't reset
+*/
+/**************************************************************************/
+void MAX6675RingBuffer::clear(void)
+{
+  _tail = _head;
+}
@@ -0,0 +1,94 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675RingBuffer is a lock-free single-producer/
+   single-consumer queue of timestamped raw samples in user allocated static memory,
+   filled by the acquisition path & drained by the application.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675RingBuffer_h
+#define MAX6675RingBuffer_h
+
+#include <MAX6675.h>
+
+#if defined(__AVR__)
+typedef uint8_t  max6675_index_t;                                 //8-bit access is atomic on AVR, max capacity 128 samples
+#else
+typedef uint16_t max6675_index_t;                                 //16-bit access is atomic on 32-bit MCU, max capacity 32768 samples
+#endif
+
+#if defined(__AVR__)
+#define MAX6675_MEMORY_BARRIER() __asm__ __volatile__("" ::: "memory") //single core, compiler barrier is enough
+#else
+#define MAX6675_MEMORY_BARRIER() __sync_synchronize()                   //full barrier for dual core ESP32
+#endif
+
+#define MAX6675_RING_MAX_CAPACITY (((max6675_index_t)~0 >> 1) + 1)     //half of index range, so full & empty never look the same
+
+typedef struct
+{
+  uint32_t timestamp;                                             //in microseconds, micros() when the sample was read
+  uint16_t rawValue;                                              //see MAX6675::readRawData()
+  uint8_t  channel;                                               //channel number, 0 for single sensor
+} MAX6675Sample;
+
+
+class MAX6675RingBuffer
+{
+  public:
+   MAX6675RingBuffer(MAX6675Sample *buffer, uint16_t size);
+
+   bool            push(uint8_t channel, uint16_t rawValue, uint32_t timestamp);
+   bool            pop(MAX6675Sample &sample);
+   max6675_index_t read(MAX6675Sample *samples, max6675_index_t maxQnt);
+   max6675_index_t available(void);
+   max6675_index_t getCapacity(void);
+   uint32_t        getOverflowQnt(void);
+   void            clear(void);
+
+  private:
+            MAX6675Sample   *_buffer;
+            max6675_index_t  _mask;
+   volatile max6675_index_t  _head;                               //written by producer only
+   volatile max6675_index_t  _tail;                               //written by consumer only
+   volatile uint32_t         _overflowQnt;                        //written by producer only
+};
+
+#endif
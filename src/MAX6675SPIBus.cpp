@@ -0,0 +1,238 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation conneted to hardware 4Mhz SPI with maximum sampling
+   rate ~4..5Hz. MAX6675SPIBus reads all ready sensors in one SPI transaction & tells
+   when the bus is free for other devices, like SD card or display.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX6675SPIBus.h>
+
+
+/**************************************************************************/
+/*
+    MAX6675SPIBus()
+
+    Constructor for shared hardware SPI bus scheduler
+
+    NOTE:
+    - SPI settings are shared with MAX6675, see MAX6675HardwareSPI::getSettings()
+    - call begin() of every sensor before adding it to the bus
+    - only hardware SPI sensors MAX6675 are supported, see addSensor()
+*/
+/**************************************************************************/
+MAX6675SPIBus::MAX6675SPIBus(void)
+{
+  _sensorQnt = 0;
+}
+
+/**************************************************************************/
+/*
+    addSensor()
+
+    Adds sensor to the bus, returns false if the bus is full or
+    sensor isn't on hardware SPI
+
+    NOTE:
+    - MAX6675Soft & MAX6675SoftFast are rejected, their SO & SCK
+      pins aren't the hardware SPI bus
+    - sensor is known to be on hardware SPI only after MAX6675::begin(),
+      call it before addSensor()
+*/
+/**************************************************************************/
+bool MAX6675SPIBus::addSensor(MAX6675 &sensor)
+{
+  if (_sensorQnt >= MAX6675_SPI_BUS_MAX_SENSORS) return false;
+  if (sensor._hardwareSPI != true)               return false;
+
+  _sensor[_sensorQnt]  = &sensor;
+  _rawData[_sensorQnt] = MAX6675_NO_DATA;
+
+  _sensorQnt++;
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    getSensorQnt()
+
+    Returns qnt. of sensors on the bus
+*/
+/**************************************************************************/
+uint8_t MAX6675SPIBus::getSensorQnt(void)
+{
+  return _sensorQnt;
+}
+
+/**************************************************************************/
+/*
+    service()
+
+    Reads every sensor whose conversion is done, returns bitmask of
+    channels with new data, bit 0 is channel 0, doesn't block
+
+    NOTE:
+    - all ready sensors are read in one SPI transaction window, so
+      SPI.beginTransaction()/SPI.endTransaction() are called once per window
+      & not for every sensor
+    - forcing CS low immediately stops the conversion, CS of a sensor that
+      is still converting is never touched, other devices on the bus don't
+      abort conversions because MAX6675 SO is in high impedance while CS is high
+    - sensor that isn't converting yet is started here
+    - next conversion is timed from the end of the window, so it can't be
+      read too early, conversion of the first sensors is only a few
+      microseconds longer
+*/
+/**************************************************************************/
+uint8_t MAX6675SPIBus::service(void)
+{
+  uint8_t  readyMask = 0;
+  uint32_t now       = micros();
+
+  for (uint8_t i = 0; i < _sensorQnt; i++)
+  {
+    if (_sensor[i]->_state != MAX6675_STATE_CONVERTING)
+    {
+      _sensor[i]->startConversion();                                //CS was high or unknown, nothing to abort
+
+      continue;
+    }
+
+    if ((now - _sensor[i]->_conversionStart) >= ((uint32_t)MAX6675_CONVERSION_TIME * 1000)) bitSet(readyMask, i);
+  }
+
+  if (readyMask == 0) return 0;
+
+  SPI.beginTransaction(MAX6675HardwareSPI::getSettings());          //one window for all ready sensors
+
+  for (uint8_t i = 0; i < _sensorQnt; i++)
+  {
+    if (bitRead(readyMask, i) == 0) continue;
+
+    #ifdef MAX6675_ENABLE_STATS
+    uint32_t readStart = micros();
+    #endif
+
+    _rawData[i] = MAX6675HardwareSPI(_sensor[i]->_cs).transferInTransaction(); //CS high starts next conversion
+
+    _sensor[i]->_lastRawData = _rawData[i];
+
+    #ifdef MAX6675_ENABLE_STATS
+    uint32_t busTime = micros() - readStart;
+
+    _sensor[i]->_updateStats(_rawData[i], busTime, busTime);    //caller is blocked only for the transfer
+    #endif
+  }
+
+  SPI.endTransaction();
+
+  now = micros();
+
+  for (uint8_t i = 0; i < _sensorQnt; i++)
+  {
+    if (bitRead(readyMask, i) != 0) _sensor[i]->_conversionStart = now;
+  }
+
+  return readyMask;
+}
+
+/**************************************************************************/
+/*
+    timeToNextRead()
+
+    Returns time till the next sensor is ready, in microseconds
+
+    NOTE:
+    - 0 means call service() now
+    - SPI transaction of other device shorter than this time doesn't
+      delay any thermocouple read
+    - returns MAX6675_SPI_BUS_NO_READ if there is no sensor
+*/
+/**************************************************************************/
+uint32_t MAX6675SPIBus::timeToNextRead(void)
+{
+  uint32_t nextRead = MAX6675_SPI_BUS_NO_READ;
+  uint32_t now      = micros();
+  uint32_t elapsed  = 0;
+
+  for (uint8_t i = 0; i < _sensorQnt; i++)
+  {
+    if (_sensor[i]->_state != MAX6675_STATE_CONVERTING) return 0;
+
+    elapsed = now - _sensor[i]->_conversionStart;
+
+    if (elapsed >= ((uint32_t)MAX6675_CONVERSION_TIME * 1000)) return 0;
+
+    if ((((uint32_t)MAX6675_CONVERSION_TIME * 1000) - elapsed) < nextRead) nextRead = ((uint32_t)MAX6675_CONVERSION_TIME * 1000) - elapsed;
+  }
+
+  return nextRead;
+}
+
+/**************************************************************************/
+/*
+    getRawData()
+
+    Returns last raw data of the channel
+
+    NOTE:
+    - returns MAX6675_NO_DATA if channel doesn't exist or hasn't been read yet
+*/
+/**************************************************************************/
+uint16_t MAX6675SPIBus::getRawData(uint8_t channel)
+{
+  if (channel >= _sensorQnt) return MAX6675_NO_DATA;
+
+  return _rawData[channel];
+}
+
+/**************************************************************************/
+/*
+    getReading()
+
+    Returns last raw data of the channel decoded in one pass,
+    see MAX6675::decodeRawData()
+*/
+/**************************************************************************/
+MAX6675Reading MAX6675SPIBus::getReading(uint8_t channel)
+{
+  return MAX6675::decodeRawData(getRawData(channel));
+}
@@ -0,0 +1,73 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation conneted to hardware 4Mhz SPI with maximum sampling
+   rate ~4..5Hz. MAX6675SPIBus reads all ready sensors in one SPI transaction & tells
+   when the bus is free for other devices, like SD card or display.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675SPIBus_h
+#define MAX6675SPIBus_h
+
+#include <MAX6675.h>
+
+#define MAX6675_SPI_BUS_MAX_SENSORS 8          //max qnt. of sensors on the bus, service() returns 8-bit mask
+#define MAX6675_SPI_BUS_NO_READ     0xFFFFFFFF //returned by timeToNextRead() if there is no sensor
+
+
+class MAX6675SPIBus
+{
+  public:
+   MAX6675SPIBus(void);
+
+   bool           addSensor(MAX6675 &sensor);
+   uint8_t        getSensorQnt(void);
+   uint8_t        service(void);
+   uint32_t       timeToNextRead(void);
+   uint16_t       getRawData(uint8_t channel);
+   MAX6675Reading getReading(uint8_t channel);
+
+  private:
+   MAX6675 *_sensor[MAX6675_SPI_BUS_MAX_SENSORS];
+   uint16_t _rawData[MAX6675_SPI_BUS_MAX_SENSORS];
+   uint8_t  _sensorQnt;
+};
+
+#endif
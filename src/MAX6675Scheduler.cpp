@@ -0,0 +1,385 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675Scheduler reads every sensor as often as
+   its temperature changes, ramping channels every ~220msec & steady or broken ones
+   rarely, so the bus & CPU time are spent on the channels that are changing.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX6675Scheduler.h>
+
+
+/**************************************************************************/
+/*
+    MAX6675Scheduler()
+
+    Constructor for adaptive sampling scheduler
+
+    NOTE:
+    - call begin() of every sensor before adding it to the scheduler
+    - default interval limits are MAX6675_SCHEDULER_MIN_INTERVAL..MAX6675_SCHEDULER_MAX_INTERVAL,
+      max change is MAX6675_SCHEDULER_MAX_CHANGE & bus budget is 1 read per update()
+*/
+/**************************************************************************/
+MAX6675Scheduler::MAX6675Scheduler(void)
+{
+  _sensorQnt   = 0;
+  _busBudget   = 1;
+  _maxChange   = MAX6675_SCHEDULER_MAX_CHANGE;
+  _minInterval = MAX6675_SCHEDULER_MIN_INTERVAL;
+  _maxInterval = MAX6675_SCHEDULER_MAX_INTERVAL;
+}
+
+/**************************************************************************/
+/*
+    addSensor()
+
+    Adds sensor to the scheduler, returns false if the scheduler is full
+
+    NOTE:
+    - sensor is switched to free-running mode, CS stays high between reads,
+      so the chip always has the result of the last conversion & every
+      read is immediate, see MAX6675::setFreeRunning()
+    - first read is due after one conversion time
+*/
+/**************************************************************************/
+bool MAX6675Scheduler::addSensor(MAX6675 &sensor)
+{
+  if (_sensorQnt >= MAX6675_SCHEDULER_MAX_SENSORS) return false;
+
+  sensor.setFreeRunning(true);
+
+  _sensor[_sensorQnt]   = &sensor;
+  _rawData[_sensorQnt]  = MAX6675_NO_DATA;
+  _interval[_sensorQnt] = _minInterval;
+  _nextDue[_sensorQnt]  = millis() + MAX6675_CONVERSION_TIME;
+  _lastRead[_sensorQnt] = 0;
+  _slope[_sensorQnt]    = MAX6675_SCHEDULER_NO_SLOPE;
+  _faultQnt[_sensorQnt] = 0;
+
+  _sensorQnt++;
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    getSensorQnt()
+
+    Returns qnt. of sensors in the scheduler
+*/
+/**************************************************************************/
+uint8_t MAX6675Scheduler::getSensorQnt(void)
+{
+  return _sensorQnt;
+}
+
+/**************************************************************************/
+/*
+    setIntervalLimits()
+
+    Sets min. & max. read interval of every channel, in milliseconds
+
+    NOTE:
+    - min. interval is limited to MAX6675_CONVERSION_TIME, chip can't
+      provide new data faster
+    - max. interval is at least min. interval, steady channels are
+      still read at max. interval to catch slow drift & faults
+    - both are limited to 0x7FFFFFFF msec ~24 days, due time is compared
+      as signed difference, so it is roll over safe
+*/
+/**************************************************************************/
+void MAX6675Scheduler::setIntervalLimits(uint32_t minInterval, uint32_t maxInterval)
+{
+  if (maxInterval > 0x7FFFFFFF)              maxInterval = 0x7FFFFFFF;
+  if (minInterval > 0x7FFFFFFF)              minInterval = 0x7FFFFFFF;
+  if (minInterval < MAX6675_CONVERSION_TIME) minInterval = MAX6675_CONVERSION_TIME;
+  if (maxInterval < minInterval)             maxInterval = minInterval;
+
+  _minInterval = minInterval;
+  _maxInterval = maxInterval;
+
+  for (uint8_t i = 0; i < _sensorQnt; i++)
+  {
+    if      (_interval[i] < _minInterval) _interval[i] = _minInterval;
+    else if (_interval[i] > _maxInterval) _interval[i] = _maxInterval;
+  }
+}
+
+/**************************************************************************/
+/*
+    setMaxChange()
+
+    Sets max. expected temperature change between two reads of the channel,
+    in quarter-degrees, 4 is 1°C
+
+    NOTE:
+    - interval = maxChange / |slope|, smaller value means more reads
+*/
+/**************************************************************************/
+void MAX6675Scheduler::setMaxChange(uint16_t maxChange)
+{
+  if (maxChange == 0) maxChange = 1;
+
+  _maxChange = maxChange;
+}
+
+/**************************************************************************/
+/*
+    setBusBudget()
+
+    Sets max. qnt. of sensors read by one update() call
+
+    NOTE:
+    - one read is ~12μsec of bus time with 4MHz SPI plus CPU time of
+      digitalWrite() & micros(), limit it to keep loop() time predictable
+    - if more channels are due than the budget, the most overdue channels
+      are read first & others wait for the next update()
+*/
+/**************************************************************************/
+void MAX6675Scheduler::setBusBudget(uint8_t maxReads)
+{
+  if (maxReads == 0) maxReads = 1;
+
+  _busBudget = maxReads;
+}
+
+/**************************************************************************/
+/*
+    update()
+
+    Reads channels that are due, returns bitmask of channels with new
+    data, bit 0 is channel 0, doesn't block
+
+    NOTE:
+    - call it as often as possible from the loop()
+    - reads at most bus budget channels, most overdue first
+    - channel isn't read if its conversion isn't done yet, for example
+      because the sensor was read outside the scheduler
+*/
+/**************************************************************************/
+uint8_t MAX6675Scheduler::update(void)
+{
+  uint8_t  readMask  = 0;
+  uint8_t  triedMask = 0;
+  uint32_t now       = millis();
+
+  for (uint8_t reads = 0; reads < _busBudget; reads++)
+  {
+    uint8_t channel = MAX6675_SCHEDULER_MAX_SENSORS;
+    int32_t overdue = -1;
+
+    for (uint8_t i = 0; i < _sensorQnt; i++)
+    {
+      int32_t lateness = (int32_t)(now - _nextDue[i]);            //roll over safe
+
+      if ((lateness > overdue) && (bitRead(triedMask, i) == 0))
+      {
+        overdue = lateness;
+        channel = i;
+      }
+    }
+
+    if (channel == MAX6675_SCHEDULER_MAX_SENSORS) break;           //nothing is due
+
+    bitSet(triedMask, channel);                                    //don't pick it again in this update()
+
+    uint16_t rawData = 0;
+
+    if (_sensor[channel]->readIfReady(rawData) != true)
+    {
+      _nextDue[channel] = now + 1;                                 //conversion isn't done, retry soon
+
+      continue;
+    }
+
+    _schedule(channel, rawData, now);
+
+    bitSet(readMask, channel);
+  }
+
+  return readMask;
+}
+
+/**************************************************************************/
+/*
+    getRawData()
+
+    Returns last raw data of the channel
+
+    NOTE:
+    - returns MAX6675_NO_DATA if channel doesn't exist or hasn't been read yet
+*/
+/**************************************************************************/
+uint16_t MAX6675Scheduler::getRawData(uint8_t channel)
+{
+  if (channel >= _sensorQnt) return MAX6675_NO_DATA;
+
+  return _rawData[channel];
+}
+
+/**************************************************************************/
+/*
+    getReading()
+
+    Returns last raw data of the channel decoded in one pass,
+    see MAX6675::decodeRawData()
+*/
+/**************************************************************************/
+MAX6675Reading MAX6675Scheduler::getReading(uint8_t channel)
+{
+  return MAX6675::decodeRawData(getRawData(channel));
+}
+
+/**************************************************************************/
+/*
+    getInterval()
+
+    Returns current read interval of the channel, in milliseconds
+*/
+/**************************************************************************/
+uint32_t MAX6675Scheduler::getInterval(uint8_t channel)
+{
+  if (channel >= _sensorQnt) return 0;
+
+  return _interval[channel];
+}
+
+/**************************************************************************/
+/*
+    getNextDue()
+
+    Returns millis() time of the next read of the channel
+*/
+/**************************************************************************/
+uint32_t MAX6675Scheduler::getNextDue(uint8_t channel)
+{
+  if (channel >= _sensorQnt) return 0;
+
+  return _nextDue[channel];
+}
+
+/**************************************************************************/
+/*
+    getSlope()
+
+    Returns smoothed rate of change of the channel, in quarter-degrees
+    per second, positive if temperature rises
+
+    NOTE:
+    - returns 0 if slope is unknown, after fault or before 2nd valid read
+    - saturates at -32768..32767
+*/
+/**************************************************************************/
+int16_t MAX6675Scheduler::getSlope(uint8_t channel)
+{
+  if ((channel >= _sensorQnt) || (_slope[channel] == MAX6675_SCHEDULER_NO_SLOPE)) return 0;
+
+  int32_t slope = _slope[channel] / (1 << MAX6675_SCHEDULER_SLOPE_BITS);
+
+  if      (slope >  32767) slope =  32767;
+  else if (slope < -32768) slope = -32768;
+
+  return slope;
+}
+
+/**************************************************************************/
+/*
+    _schedule()
+
+    Stores new data of the channel, updates slope & next read time
+
+    NOTE:
+    - slope is exponential moving average of the last reads, 1/4 weight
+      of new value, so one noisy read doesn't shorten the interval much,
+      1st slope after unknown one is taken as is, so ramping channel
+      doesn't lag behind while the average settles
+    - interval = max. change / |slope|, clamped to min. & max. interval
+    - open thermocouple or ID error doubles current interval on every
+      consecutive fault & saturates at max. interval, so broken channel doesn't
+      waste bus time, first good read after fault restarts at min. interval
+      because the slope is unknown
+*/
+/**************************************************************************/
+void MAX6675Scheduler::_schedule(uint8_t channel, uint16_t rawValue, uint32_t now)
+{
+  MAX6675Reading reading  = MAX6675::decodeRawData(rawValue);
+  MAX6675Reading previous = MAX6675::decodeRawData(_rawData[channel]);
+  uint32_t       interval = _maxInterval;
+
+  if ((reading.idValid != true) || (reading.thermocoupleOpen == true))
+  {
+    if (_faultQnt[channel] < 0xFF) _faultQnt[channel]++;
+
+    if (_interval[channel] > (_maxInterval >> 1)) interval = _maxInterval; //saturates, doubling can't overflow
+    else                                          interval = _interval[channel] << 1;
+
+    _slope[channel] = MAX6675_SCHEDULER_NO_SLOPE;
+  }
+  else if ((_faultQnt[channel] != 0) || (_rawData[channel] == MAX6675_NO_DATA) || (now == _lastRead[channel]))
+  {
+    _faultQnt[channel] = 0;
+
+    interval = _minInterval;                                       //no valid previous reading, slope is unknown
+
+    _slope[channel]    = MAX6675_SCHEDULER_NO_SLOPE;
+    _lastRead[channel] = now;
+  }
+  else
+  {
+    int32_t slope = ((int32_t)(reading.temperature - previous.temperature) * (1000L << MAX6675_SCHEDULER_SLOPE_BITS)) / (int32_t)(now - _lastRead[channel]);
+
+    if (_slope[channel] == MAX6675_SCHEDULER_NO_SLOPE) _slope[channel]  = slope;
+    else                                               _slope[channel] += (slope - _slope[channel]) / 4;
+
+    _lastRead[channel] = now;
+
+    uint32_t change = (_slope[channel] < 0) ? -_slope[channel] : _slope[channel];
+
+    if (change != 0) interval = ((uint32_t)_maxChange * (1000UL << MAX6675_SCHEDULER_SLOPE_BITS)) / change;
+  }
+
+  if      (interval < _minInterval) interval = _minInterval;
+  else if (interval > _maxInterval) interval = _maxInterval;
+
+  _rawData[channel]  = rawValue;
+  _interval[channel] = interval;
+  _nextDue[channel]  = now + interval;
+}
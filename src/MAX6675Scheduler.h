@@ -0,0 +1,93 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675Scheduler reads every sensor as often as
+   its temperature changes, ramping channels every ~220msec & steady or broken ones
+   rarely, so the bus & CPU time are spent on the channels that are changing.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675Scheduler_h
+#define MAX6675Scheduler_h
+
+#include <MAX6675.h>
+
+#define MAX6675_SCHEDULER_MAX_SENSORS  8                       //max qnt. of sensors, update() returns 8-bit mask, every sensor costs pointer + 19 bytes of RAM
+#define MAX6675_SCHEDULER_MIN_INTERVAL MAX6675_CONVERSION_TIME //in milliseconds, default & lowest min. interval
+#define MAX6675_SCHEDULER_MAX_INTERVAL 5000                    //in milliseconds, default max. interval
+#define MAX6675_SCHEDULER_MAX_CHANGE   4                       //in quarter-degrees, default max. change between reads, 1°C
+#define MAX6675_SCHEDULER_SLOPE_BITS   4                       //fraction bits of smoothed slope, keeps small slopes from truncating to zero
+#define MAX6675_SCHEDULER_NO_SLOPE     (-2147483647L - 1)      //slope is unknown, no valid previous read
+
+
+class MAX6675Scheduler
+{
+  public:
+   MAX6675Scheduler(void);
+
+   bool           addSensor(MAX6675 &sensor);
+   uint8_t        getSensorQnt(void);
+   void           setIntervalLimits(uint32_t minInterval, uint32_t maxInterval);
+   void           setMaxChange(uint16_t maxChange);
+   void           setBusBudget(uint8_t maxReads);
+   uint8_t        update(void);
+   uint16_t       getRawData(uint8_t channel);
+   MAX6675Reading getReading(uint8_t channel);
+   uint32_t       getInterval(uint8_t channel);
+   uint32_t       getNextDue(uint8_t channel);
+   int16_t        getSlope(uint8_t channel);
+
+  private:
+   MAX6675 *_sensor[MAX6675_SCHEDULER_MAX_SENSORS];
+   uint16_t _rawData[MAX6675_SCHEDULER_MAX_SENSORS];
+   uint32_t _interval[MAX6675_SCHEDULER_MAX_SENSORS];     //in milliseconds
+   uint32_t _nextDue[MAX6675_SCHEDULER_MAX_SENSORS];      //in milliseconds, millis() of next read
+   uint32_t _lastRead[MAX6675_SCHEDULER_MAX_SENSORS];     //in milliseconds, millis() of last valid read
+   int32_t  _slope[MAX6675_SCHEDULER_MAX_SENSORS];        //in 1/2^MAX6675_SCHEDULER_SLOPE_BITS quarter-degrees per second, smoothed
+   uint8_t  _faultQnt[MAX6675_SCHEDULER_MAX_SENSORS];     //consecutive reads with open thermocouple or ID error
+   uint8_t  _sensorQnt;
+   uint8_t  _busBudget;
+   uint16_t _maxChange;
+   uint32_t _minInterval;
+   uint32_t _maxInterval;
+
+   void _schedule(uint8_t channel, uint16_t rawValue, uint32_t now);
+};
+
+#endif
@@ -54,12 +54,12 @@
     cs  - chip select, set CS low to enable the serial interface
     so  - serial data output
     sck - serial clock input
+    - on AVR port registers & bitmasks are looked up by MAX6675DigitalPins
+      constructor, so read before begin() never writes through null port pointer
 */
 /**************************************************************************/
-MAX6675Soft::MAX6675Soft(uint8_t cs, uint8_t so, uint8_t sck) : MAX6675(cs)
+MAX6675Soft::MAX6675Soft(uint8_t cs, uint8_t so, uint8_t sck) : MAX6675(cs), _transport(cs, so, sck)
 {
-  _so  = so;  //sw miso
-  _sck = sck; //sw sclk
 }
 
 /**************************************************************************/
@@ -71,69 +71,29 @@ MAX6675Soft::MAX6675Soft(uint8_t cs, uint8_t so, uint8_t sck) : MAX6675(cs)
 /**************************************************************************/
 void MAX6675Soft::begin(void)
 {
-  pinMode(_cs, OUTPUT);
-  digitalWrite(_cs, HIGH); //disables SPI interface for MAX31855, but it will initiate measurement/conversion
+  _transport.begin();      //CS high initiates measurement/conversion, SCK low
 
-  pinMode(_so, INPUT);
-
-  pinMode(_sck, OUTPUT);
-  digitalWrite(_sck, LOW); 
+  _conversionStart = micros();
+  _state           = MAX6675_STATE_CONVERTING;
 }
 
 /**************************************************************************/
 /*
-    readRawData()
+    _readData()
 
     Reads raw data from MAX6675 via software/bit-bang SPI
 
     NOTE:
-    - forcing CS low immediately stops any conversion process, force CS high
-      to initiate a new measurement process
-    - set CS low to enable the serial interface & force to output the first bit on the SO pin,
-      apply 16 clock signals at SCK to read the results at SO on the falling edge of the SCK
-    - bit D15 is a dummy sign bit and is always zero.
-    - bits D14..D3 contain the converted temperature in the order of MSB to LSB
-    - bit D2 is normally low & goes high when the thermocouple is broken or unplugged
-      to allow the operation of the open thermocouple detector the "T-" pin must be grounded
-    - bit D1 is low to provide a device ID for the MAX6675
-    - bit D0 is three-state
-    - sequence of all zeros on SO pin means the thermocouple reading is 0°C
-    - sequence of all ones  on SO pin means the thermocouple reading is +1023.75°C
-
-    - max SPI master clock speed is equal with board speed
-      (16000000UL for 5V 16MHz/ProMini), but MAX6675 max speed is only 4.3MHz
-    - SPI_MODE0 -> data available shortly after the rising edge of SCK
+    - transport is shared with MAX6675Driver<>, see MAX6675SoftSPI::transfer()
+    - time with interrupts disabled is counted if MAX6675_ENABLE_STATS
+      is defined, see MAX6675_DISABLE_INTERRUPTS
 */
 /**************************************************************************/
-uint16_t MAX6675Soft::readRawData(void)
+uint16_t MAX6675Soft::_readData(void)
 {
-  uint16_t rawData = 0;
-
-  digitalWrite(_cs, LOW);                        //stop  measurement/conversion
-  delayMicroseconds(1);                          //4MHz  is 0.25usec, do we need it???
-  digitalWrite(_cs, HIGH);                       //start measurement/conversion
-
-  delay(MAX6675_CONVERSION_TIME);
-
-  digitalWrite(_cs, LOW);                        //set CS low to enable SPI interface for MAX6675
-
-  #ifdef MAX6675_DISABLE_INTERRUPTS
-  noInterrupts();                                //disable all interrupts for critical operations below
+  #ifdef MAX6675_ENABLE_STATS
+  return _transport.transfer(&_stats.irqOffTime);
+  #else
+  return _transport.transfer();
   #endif
-
-  /* emulate SPI_MODE0 */
-  for (int8_t i = 16; i > 0; i--)                //read 16-bits via software SPI, in order MSB->LSB (D15..D0 bit)
-  {
-    digitalWrite(_sck, HIGH);                    //data available shortly after rising edge of SCK
-    rawData = (rawData << 1) | digitalRead(_so);
-    digitalWrite(_sck, LOW);                     //data is clocked out on falling edge of SCK
-  }
-
-  #ifdef MAX6675_DISABLE_INTERRUPTS
-  interrupts();                                  //re-enable all interrupts
-  #endif
-
-  digitalWrite(_cs, HIGH);                       //disables SPI interface for MAX6675, but it will initiate measurement/conversion
-
-  return rawData;
 }
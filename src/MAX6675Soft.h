@@ -44,18 +44,7 @@
 #ifndef MAX6675Soft_h
 #define MAX6675Soft_h
 
-/*
-   Unfortunately, you cannot #define something in the sketch & get
-   it in the library, because the Arduino toolchain includes library
-   files & compiles them in advance, not knowing where it will be used.
-
-   - uncomment to disable interrupts during bit-bang
-*/
-//#define MAX6675_DISABLE_INTERRUPTS
-
-#define MAX6675_SOFT_SPI //disable upload hw driver spi.h
-
-#include <MAX6675.h>
+#include <MAX6675.h>                     //MAX6675_DISABLE_INTERRUPTS & MAX6675_SOFT_SCK_DELAY are in MAX6675Transport.h
 
 
 class MAX6675Soft : public MAX6675
@@ -64,12 +53,13 @@ class MAX6675Soft : public MAX6675
    MAX6675Soft(uint8_t cs, uint8_t so, uint8_t sck);
 
    void     begin(void);
-   uint16_t readRawData(void);
  
 
   private:
-   uint8_t _so;
-   uint8_t _sck;
+   MAX6675SoftSPI<MAX6675DigitalPins> _transport;
+
+  protected:
+   uint16_t _readData(void);
 };
 
 #endif
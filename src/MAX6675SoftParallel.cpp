@@ -0,0 +1,337 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation conneted to software/bit-bang SPI with maximum sampling
+   rate ~4..5Hz. MAX6675SoftParallel reads up to 8 sensors on AVR or 32 sensors on 32-bit
+   boards with shared CS & SCK in 16 clocks, every sensor SO is on the same input port.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   Board:                                     Level
+   Uno, Mini, Pro, ATmega168, ATmega328.....  5v
+   Mega, Mega2560, ATmega1280, ATmega2560...  5v
+   Due, SAM3X8E.............................  3.3v
+   Leonardo, ProMicro, ATmega32U4...........  5v
+   Blue Pill, STM32F103xxxx boards..........  3v
+   NodeMCU 1.0, WeMos D1 Mini...............  3v/5v*
+   ESP32....................................  3v
+
+                                              *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                               for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+
+#include <MAX6675SoftParallel.h>
+
+
+/**************************************************************************/
+/*
+    MAX6675SoftParallel()
+
+    Constructor for software/bit-bang read only SPI with shared CS & SCK
+
+    NOTE:
+    cs        - chip select shared by all sensors
+    sck       - serial clock input shared by all sensors
+    so        - array of serial data outputs, one pin per sensor,
+                array must live as long as the object, sensor index in
+                the array is the channel number
+    sensorQnt - qnt. of sensors, 1..MAX6675_PARALLEL_MAX_SENSORS
+*/
+/**************************************************************************/
+MAX6675SoftParallel::MAX6675SoftParallel(uint8_t cs, uint8_t sck, const uint8_t *so, uint8_t sensorQnt)
+{
+  _cs              = cs;
+  _sck             = sck;
+  _so              = so;
+  _sensorQnt       = (sensorQnt > MAX6675_PARALLEL_MAX_SENSORS) ? MAX6675_PARALLEL_MAX_SENSORS : sensorQnt;
+  _state           = MAX6675_STATE_IDLE;
+  _conversionStart = 0;
+
+  #if defined(MAX6675_PARALLEL_PORT_READ)
+  _soPort          = 0;
+  #endif
+
+  for (uint8_t i = 0; i < MAX6675_PARALLEL_MAX_SENSORS; i++)
+  {
+    _rawData[i] = MAX6675_NO_DATA;
+    _soMask[i]  = 0;
+  }
+}
+
+/**************************************************************************/
+/*
+    begin()
+
+    Initializes & configures soft/bit-bang SPI, returns false if
+    SO pins are not on the same input port
+
+    NOTE:
+    - ESP8266 GPIO16 is not on the GPIO port & can't be used as SO
+*/
+/**************************************************************************/
+bool MAX6675SoftParallel::begin(void)
+{
+  if (_sensorQnt == 0) return false;
+
+  #if defined(MAX6675_PARALLEL_PORT_READ)
+  _soPort = (volatile max6675_port_t *)portInputRegister(digitalPinToPort(_so[0]));
+
+  for (uint8_t i = 0; i < _sensorQnt; i++)
+  {
+    if ((volatile max6675_port_t *)portInputRegister(digitalPinToPort(_so[i])) != _soPort) return false; //all SO must be on the same port
+
+    _soMask[i] = digitalPinToBitMask(_so[i]);
+  }
+  #else
+  for (uint8_t i = 0; i < _sensorQnt; i++) _soMask[i] = ((max6675_port_t)1 << i);                     //synthetic port, see _readPort()
+  #endif
+
+  pinMode(_cs, OUTPUT);
+  digitalWrite(_cs, HIGH); //disables SPI interface for MAX6675, but it will initiate measurement/conversion
+
+  for (uint8_t i = 0; i < _sensorQnt; i++) pinMode(_so[i], INPUT);
+
+  pinMode(_sck, OUTPUT);
+  digitalWrite(_sck, LOW);
+
+  _conversionStart = micros();
+  _state           = MAX6675_STATE_CONVERTING;
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    getSensorQnt()
+
+    Returns qnt. of sensors
+*/
+/**************************************************************************/
+uint8_t MAX6675SoftParallel::getSensorQnt(void)
+{
+  return _sensorQnt;
+}
+
+/**************************************************************************/
+/*
+    startConversion()
+
+    Aborts current conversion of all sensors & starts a new one,
+    doesn't block
+
+    NOTE:
+    - CS is shared, so all sensors start conversion at the same moment
+*/
+/**************************************************************************/
+void MAX6675SoftParallel::startConversion(void)
+{
+  digitalWrite(_cs, LOW);      //stop  measurement/conversion
+  delayMicroseconds(1);        //4MHz  is 0.25μsec, do we need it???
+  digitalWrite(_cs, HIGH);     //start measurement/conversion
+
+  _conversionStart = micros();
+  _state           = MAX6675_STATE_CONVERTING;
+}
+
+/**************************************************************************/
+/*
+    isReady()
+
+    Returns true if conversion time has passed since CS was forced high,
+    see MAX6675::isReady() for details
+*/
+/**************************************************************************/
+bool MAX6675SoftParallel::isReady(void)
+{
+  if (_state != MAX6675_STATE_CONVERTING) return false;
+
+  return ((micros() - _conversionStart) >= ((uint32_t)MAX6675_CONVERSION_TIME * 1000));
+}
+
+/**************************************************************************/
+/*
+    readIfReady()
+
+    Reads raw data of all sensors if conversion is done, returns true
+    on success, doesn't block
+
+    NOTE:
+    - CS goes high at the end of the read & initiates next conversion,
+      see getRawData()
+*/
+/**************************************************************************/
+bool MAX6675SoftParallel::readIfReady(void)
+{
+  if (isReady() != true) return false;
+
+  _readData();
+
+  _conversionStart = micros();             //CS is high again & new conversion is in progress
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    poll()
+
+    Non-blocking state machine, call it as often as possible from the loop(),
+    returns true when new raw data of all sensors is available,
+    see MAX6675::poll() for details
+*/
+/**************************************************************************/
+bool MAX6675SoftParallel::poll(void)
+{
+  if (_state == MAX6675_STATE_IDLE)
+  {
+    startConversion();
+
+    return false;
+  }
+
+  return readIfReady();
+}
+
+/**************************************************************************/
+/*
+    readRawData()
+
+    Starts new conversion of all sensors & reads raw data, blocks
+    for MAX6675_CONVERSION_TIME, see getRawData()
+*/
+/**************************************************************************/
+void MAX6675SoftParallel::readRawData(void)
+{
+  startConversion();
+
+  while (readIfReady() != true)
+  {
+    yield();                               //prevents ESP8266/ESP32 watchdog reset
+  }
+}
+
+/**************************************************************************/
+/*
+    getRawData()
+
+    Returns last raw data of the channel, MAX6675_NO_DATA if channel
+    doesn't exist or has never been read
+*/
+/**************************************************************************/
+uint16_t MAX6675SoftParallel::getRawData(uint8_t channel)
+{
+  if (channel >= _sensorQnt) return MAX6675_NO_DATA;
+
+  return _rawData[channel];
+}
+
+/**************************************************************************/
+/*
+    _readPort()
+
+    Returns state of all SO pins at once
+
+    NOTE:
+    - if the core has no port registers, SO pins are read one by one
+      & packed into synthetic port where bit N is the channel N
+*/
+/**************************************************************************/
+max6675_port_t MAX6675SoftParallel::_readPort(void)
+{
+  #if defined(MAX6675_PARALLEL_PORT_READ)
+  return *_soPort;
+  #else
+  max6675_port_t port = 0;
+
+  for (uint8_t i = 0; i < _sensorQnt; i++)
+  {
+    if (digitalRead(_so[i]) == HIGH) port |= _soMask[i];
+  }
+
+  return port;
+  #endif
+}
+
+/**************************************************************************/
+/*
+    _readData()
+
+    Reads raw data of all sensors via software/bit-bang SPI
+
+    NOTE:
+    - every SCK edge samples the whole input port once & saves it as
+      one bit-slice, 16 slices for 16-bits D15..D0
+    - after CS goes high bit-slices are transposed into 16-bit word
+      of every sensor, see MAX6675::decodeRawData() for data format
+*/
+/**************************************************************************/
+void MAX6675SoftParallel::_readData(void)
+{
+  max6675_port_t slice[16];
+
+  digitalWrite(_cs, LOW);                        //set CS low to enable SPI interface for MAX6675
+
+  #ifdef MAX6675_DISABLE_INTERRUPTS
+  noInterrupts();                                //disable all interrupts for critical operations below
+  #endif
+
+  /* emulate SPI_MODE0 */
+  for (uint8_t i = 0; i < 16; i++)               //read 16 slices via software SPI, in order MSB->LSB (D15..D0 bit)
+  {
+    digitalWrite(_sck, HIGH);                    //data available shortly after rising edge of SCK
+
+    #if MAX6675_SOFT_SCK_DELAY > 0
+    delayMicroseconds(MAX6675_SOFT_SCK_DELAY);
+    #endif
+
+    slice[i] = _readPort();
+    digitalWrite(_sck, LOW);                     //data is clocked out on falling edge of SCK
+
+    #if MAX6675_SOFT_SCK_DELAY > 0
+    delayMicroseconds(MAX6675_SOFT_SCK_DELAY);
+    #endif
+  }
+
+  #ifdef MAX6675_DISABLE_INTERRUPTS
+  interrupts();                                  //re-enable all interrupts
+  #endif
+
+  digitalWrite(_cs, HIGH);                       //disables SPI interface for MAX6675, but it will initiate measurement/conversion
+
+  /* un-transpose bit-slices into 16-bit words */
+  for (uint8_t channel = 0; channel < _sensorQnt; channel++)
+  {
+    uint16_t       rawData = 0;
+    max6675_port_t mask    = _soMask[channel];
+
+    for (uint8_t i = 0; i < 16; i++)
+    {
+      rawData = (rawData << 1) | ((slice[i] & mask) != 0);
+    }
+
+    _rawData[channel] = rawData;
+  }
+}
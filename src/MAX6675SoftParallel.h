@@ -0,0 +1,96 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation conneted to software/bit-bang SPI with maximum sampling
+   rate ~4..5Hz. MAX6675SoftParallel reads up to 8 sensors on AVR or 32 sensors on 32-bit
+   boards with shared CS & SCK in 16 clocks, every sensor SO is on the same input port.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   Board:                                     Level
+   Uno, Mini, Pro, ATmega168, ATmega328.....  5v
+   Mega, Mega2560, ATmega1280, ATmega2560...  5v
+   Due, SAM3X8E.............................  3.3v
+   Leonardo, ProMicro, ATmega32U4...........  5v
+   Blue Pill, STM32F103xxxx boards..........  3v
+   NodeMCU 1.0, WeMos D1 Mini...............  3v/5v*
+   ESP32....................................  3v
+
+                                              *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                               for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+
+#ifndef MAX6675SoftParallel_h
+#define MAX6675SoftParallel_h
+
+#include <MAX6675.h>
+
+#if defined(__AVR__)
+typedef uint8_t  max6675_port_t;                                        //8-bit input port
+#else
+typedef uint32_t max6675_port_t;                                        //32-bit input port
+#endif
+
+#if defined(portInputRegister) && defined(digitalPinToPort) && defined(digitalPinToBitMask)
+#define MAX6675_PARALLEL_PORT_READ                                      //whole input port is read at once, otherwise SO pins are read one by one
+#endif
+
+#define MAX6675_PARALLEL_MAX_SENSORS (sizeof(max6675_port_t) * 8)       //one sensor per port bit
+
+
+class MAX6675SoftParallel
+{
+  public:
+   MAX6675SoftParallel(uint8_t cs, uint8_t sck, const uint8_t *so, uint8_t sensorQnt);
+
+   bool     begin(void);
+   uint8_t  getSensorQnt(void);
+   void     startConversion(void);
+   bool     isReady(void);
+   bool     readIfReady(void);
+   bool     poll(void);
+   void     readRawData(void);
+   uint16_t getRawData(uint8_t channel);
+
+  private:
+   const uint8_t           *_so;
+            uint8_t         _cs;
+            uint8_t         _sck;
+            uint8_t         _sensorQnt;
+            uint8_t         _state;
+            uint32_t        _conversionStart;
+            uint16_t        _rawData[MAX6675_PARALLEL_MAX_SENSORS];
+            max6675_port_t  _soMask[MAX6675_PARALLEL_MAX_SENSORS];
+
+   #if defined(MAX6675_PARALLEL_PORT_READ)
+   volatile max6675_port_t *_soPort;
+   #endif
+
+   max6675_port_t _readPort(void);
+   void           _readData(void);
+};
+
+#endif
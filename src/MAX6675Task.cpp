@@ -0,0 +1,269 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675Task is ESP32 FreeRTOS task that reads
+   MAX6675Bank at maximum sampling rate ~4..5Hz & publishes the latest reading of
+   every channel through seqlock, any task can read it without mutex & without waiting.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX6675Task.h>
+
+#if defined(ESP32)
+
+
+/**************************************************************************/
+/*
+    MAX6675Task()
+
+    Constructor for ESP32 acquisition task
+
+    NOTE:
+    - call begin() of every sensor & add all sensors to the bank before
+      begin() of the task, the task is the only one who reads the bank
+*/
+/**************************************************************************/
+MAX6675Task::MAX6675Task(MAX6675Bank &bank)
+{
+  _bank      = &bank;
+  _handle    = 0;
+  _stop      = false;
+  _running   = false;
+  _writeLock = portMUX_INITIALIZER_UNLOCKED;
+
+  for (uint8_t i = 0; i < MAX6675_BANK_MAX_SENSORS; i++)
+  {
+    _sequence[i]  = 0;
+    _reading[i]   = MAX6675::decodeRawData(MAX6675_NO_DATA);
+    _timestamp[i] = 0;
+  }
+}
+
+/**************************************************************************/
+/*
+    begin()
+
+    Creates & starts acquisition task, returns false if bank is empty
+    or task can't be created
+
+    NOTE:
+    - core 0 or 1 pins the task to the core, tskNO_AFFINITY (default)
+      lets scheduler choose, on dual core ESP32 Arduino loop() runs on core 1
+      & WiFi on core 0
+*/
+/**************************************************************************/
+bool MAX6675Task::begin(BaseType_t core, UBaseType_t priority)
+{
+  if ((_handle != 0) || (_bank->getSensorQnt() == 0)) return false;
+
+  _bank->startConversion();
+
+  _stop    = false;
+  _running = true;
+
+  if (xTaskCreatePinnedToCore(&MAX6675Task::_task, "max6675", MAX6675_TASK_STACK_SIZE, this, priority, &_handle, core) != pdPASS)
+  {
+    _handle  = 0;
+    _running = false;
+
+    return false;
+  }
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    end()
+
+    Stops acquisition task & waits till it exits, last readings stay
+    available
+
+    NOTE:
+    - task isn't deleted from outside, it may be inside SPI transaction
+      & would leave SPI bus mutex taken & CS low forever, instead it
+      checks the stop flag between reads & deletes itself
+    - notification wakes the task from its sleep, so end() waits no
+      longer than one bank read
+    - don't call it from the task callback or with higher priority than
+      the task, it waits with vTaskDelay()
+*/
+/**************************************************************************/
+void MAX6675Task::end(void)
+{
+  if (_handle == 0) return;
+
+  _stop = true;
+
+  xTaskNotifyGive(_handle);
+
+  while (_running == true) vTaskDelay(1);
+
+  _handle = 0;
+}
+
+/**************************************************************************/
+/*
+    getReading()
+
+    Copies the latest reading of the channel, returns false if channel
+    doesn't exist or has never been read, never blocks on the bus
+
+    NOTE:
+    - seqlock read, sequence is odd while writer updates the channel,
+      copy is repeated if sequence was odd or changed during the copy,
+      so reader always gets consistent reading & timestamp
+    - writer holds the channel for a few stores only, so retry is rare
+    - timestamp is micros() when the reading was received, optional
+*/
+/**************************************************************************/
+bool MAX6675Task::getReading(uint8_t channel, MAX6675Reading &reading, uint32_t *timestamp)
+{
+  uint32_t sequence  = 0;
+  uint32_t readTime  = 0;
+
+  if (channel >= _bank->getSensorQnt()) return false;
+
+  do
+  {
+    sequence = _sequence[channel];
+
+    __sync_synchronize();                          //sequence must be read before data
+
+    reading  = _reading[channel];
+    readTime = _timestamp[channel];
+
+    __sync_synchronize();                          //data must be read before sequence is checked again
+  }
+  while (((sequence & 0x01) != 0) || (sequence != _sequence[channel]));
+
+  if (timestamp != 0) *timestamp = readTime;
+
+  return (sequence != 0);
+}
+
+/**************************************************************************/
+/*
+    getUpdateQnt()
+
+    Returns qnt. of readings published for the channel, reader can
+    compare it with previous value to see if the reading is new
+*/
+/**************************************************************************/
+uint32_t MAX6675Task::getUpdateQnt(uint8_t channel)
+{
+  if (channel >= MAX6675_BANK_MAX_SENSORS) return 0;
+
+  return _sequence[channel] >> 1;
+}
+
+/**************************************************************************/
+/*
+    _task()
+
+    Acquisition task loop
+
+    NOTE:
+    - after the read CS of every sensor goes high & starts next conversion,
+      so the task sleeps for conversion time & then checks every tick
+    - stop flag is checked only between bank reads, so the task never
+      exits inside SPI transaction, sleep is a notification wait, so
+      end() can wake it
+*/
+/**************************************************************************/
+void MAX6675Task::_task(void *parameter)
+{
+  MAX6675Task *task      = (MAX6675Task *)parameter;
+  uint32_t     timestamp = 0;
+
+  while (task->_stop != true)
+  {
+    if (task->_bank->readIfReady() != true)
+    {
+      ulTaskNotifyTake(pdTRUE, 1);                 //conversion isn't done yet, wait 1 tick
+
+      continue;
+    }
+
+    timestamp = micros();
+
+    for (uint8_t channel = 0; channel < task->_bank->getSensorQnt(); channel++)
+    {
+      task->_publish(channel, task->_bank->getReading(channel), timestamp);
+    }
+
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(MAX6675_CONVERSION_TIME));
+  }
+
+  task->_running = false;                          //last access to the object, end() may return now
+
+  vTaskDelete(NULL);
+}
+
+/**************************************************************************/
+/*
+    _publish()
+
+    Writes the reading of the channel under seqlock
+
+    NOTE:
+    - write is done in critical section, so writer can't be preempted
+      by reader on the same core while sequence is odd, readers never
+      take the lock
+*/
+/**************************************************************************/
+void MAX6675Task::_publish(uint8_t channel, const MAX6675Reading &reading, uint32_t timestamp)
+{
+  portENTER_CRITICAL(&_writeLock);
+
+  _sequence[channel] = _sequence[channel] + 1;     //odd, write in progress
+
+  __sync_synchronize();
+
+  _reading[channel]   = reading;
+  _timestamp[channel] = timestamp;
+
+  __sync_synchronize();
+
+  _sequence[channel] = _sequence[channel] + 1;     //even, write done
+
+  portEXIT_CRITICAL(&_writeLock);
+}
+
+#endif
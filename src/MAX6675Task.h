@@ -0,0 +1,86 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675Task is ESP32 FreeRTOS task that reads
+   MAX6675Bank at maximum sampling rate ~4..5Hz & publishes the latest reading of
+   every channel through seqlock, any task can read it without mutex & without waiting.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675Task_h
+#define MAX6675Task_h
+
+#include <MAX6675Bank.h>
+
+#if defined(ESP32)
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define MAX6675_TASK_STACK_SIZE 2048           //in bytes
+#define MAX6675_TASK_PRIORITY   2              //above loop() priority 1
+
+
+class MAX6675Task
+{
+  public:
+   MAX6675Task(MAX6675Bank &bank);
+
+   bool     begin(BaseType_t core = tskNO_AFFINITY, UBaseType_t priority = MAX6675_TASK_PRIORITY);
+   void     end(void);
+   bool     getReading(uint8_t channel, MAX6675Reading &reading, uint32_t *timestamp = 0);
+   uint32_t getUpdateQnt(uint8_t channel);
+
+  private:
+   MAX6675Bank       *_bank;
+   TaskHandle_t       _handle;
+   volatile bool      _stop;                                        //end() asks the task to exit
+   volatile bool      _running;                                     //task is alive & may use the bus
+   portMUX_TYPE       _writeLock;
+   volatile uint32_t  _sequence[MAX6675_BANK_MAX_SENSORS];          //odd while channel is being written
+   MAX6675Reading     _reading[MAX6675_BANK_MAX_SENSORS];
+   uint32_t           _timestamp[MAX6675_BANK_MAX_SENSORS];
+
+   static void _task(void *parameter);
+          void _publish(uint8_t channel, const MAX6675Reading &reading, uint32_t timestamp);
+};
+
+#endif
+
+#endif
@@ -0,0 +1,366 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 12-bit MAX6675 K-Thermocouple to Digital Converter
+   with Cold Junction Compensation. MAX6675Transport contains the only copy of the
+   hardware & software SPI read, it is used by MAX6675, MAX6675Soft, MAX6675SoftFast
+   & MAX6675Driver<>.
+
+   - MAX6675 power supply voltage is 3.0 - 5.5v
+   - K-type thermocouples have an absolute accuracy of around ±2°C
+   - Measurement tempereture range 0°C...+1024°C with 0.25°C resolution
+   - Cold junction compensation range -20°C...+85°C
+   - Keep K-type thermocouple cold junction & MAX6675 at the same temperature
+   - Avoid placing heat-generating devices or components near the converter
+     because this may produce errors
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX6675
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4 & GPIO0/D3
+                                              for flash & boot
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX6675Transport_h
+#define MAX6675Transport_h
+
+#if defined(ARDUINO) && ((ARDUINO) >= 100) //arduino core v1.0 or later
+#include <Arduino.h>
+#else
+#include <WProgram.h>
+#endif
+
+#include <SPI.h>
+#include <MAX6675FastPin.h>
+
+/*
+   Unfortunately, you cannot #define something in the sketch & get
+   it in the library, because the Arduino toolchain includes library
+   files & compiles them in advance, not knowing where it will be used.
+
+   - hardware SPI clock in Hz, MAX6675 max SCK is 4.3MHz, higher values are limited to it
+   - uncomment to disable interrupts during bit-bang, applies to every software SPI
+     read path, MAX6675Soft, MAX6675SoftFast, MAX6675SoftParallel & MAX6675SoftDriver
+   - SCK high & low time in microseconds, MAX6675 max SCK is 4.3MHz & min SCK high/low
+     time is 100nsec, 0 is fine for all boards where pin toggle takes >100nsec
+*/
+#ifndef MAX6675_SPI_CLOCK
+#define MAX6675_SPI_CLOCK       4000000
+#endif
+
+#define MAX6675_SPI_MAX_CLOCK   4300000
+
+#if MAX6675_SPI_CLOCK > MAX6675_SPI_MAX_CLOCK
+#undef  MAX6675_SPI_CLOCK
+#define MAX6675_SPI_CLOCK       MAX6675_SPI_MAX_CLOCK
+#endif
+
+//#define MAX6675_DISABLE_INTERRUPTS
+
+#ifndef MAX6675_SOFT_SCK_DELAY
+#define MAX6675_SOFT_SCK_DELAY  0 //in microseconds
+#endif
+
+#if defined(__AVR__)
+#define MAX6675_SOFT_FAST_GPIO    //cache port registers & bitmasks in constructor, digitalWrite()/digitalRead() are slow on AVR
+#endif
+
+
+/*
+   Transport is any class with methods below, CS must be high after every call:
+
+   void     begin(void)    - configures pins & bus, sets CS high
+   void     pulseCS(void)  - sets CS low & high, aborts conversion & starts a new one
+   uint16_t transfer(void) - sets CS low, reads 16-bits D15..D0, sets CS high
+*/
+
+class MAX6675HardwareSPI
+{
+  public:
+   MAX6675HardwareSPI(uint8_t cs) : _cs(cs)
+   {
+   }
+
+   void begin(void)
+   {
+     pinMode(_cs, OUTPUT);
+     digitalWrite(_cs, HIGH);                                        //disables SPI interface for MAX6675, but it will initiate measurement/conversion
+
+     SPI.begin();                                                    //setting hardware SCK, MOSI, SS to output, pull SCK, MOSI low & SS high
+   }
+
+   void pulseCS(void)
+   {
+     digitalWrite(_cs, LOW);                                         //stop  measurement/conversion
+     delayMicroseconds(1);                                           //4MHz  is 0.25μsec, do we need it???
+     digitalWrite(_cs, HIGH);                                        //start measurement/conversion
+   }
+
+/**************************************************************************/
+/*
+    transfer()
+
+    Reads raw data from MAX6675 via hardware SPI
+
+    NOTE:
+    - set CS low to enable the serial interface & force to output the first bit on the SO pin,
+      apply 16 clock signals at SCK to read the results at SO on the falling edge of the SCK
+    - see MAX6675::decodeRawData() for data format
+    - arduino 8-bit AVR maximum SPI master clock speed is mcu speed/2,
+      for 5v-16MHz/ProMini speed is 16000000/2=8MHz
+    - arduino ESP8266 maximum SPI master clock speed is 80000000=80MHz
+    - arduino STM32 maximum SPI master clock speed is mcu speed/2,
+      for STM32F103C8 speed is 72000000/2=36MHz
+    - SPI_MODE0 -> data available shortly after the rising edge of SCK
+    - SPI clock is MAX6675_SPI_CLOCK
+*/
+/**************************************************************************/
+   uint16_t transfer(void)
+   {
+     uint16_t rawData = 0;
+
+     SPI.beginTransaction(getSettings());                            //up to 4.3MHz, read MSB first, SPI mode 0, see note
+
+     rawData = transferInTransaction();
+
+     SPI.endTransaction();                                           //de-asserting hardware CS & free hw SPI for other slaves
+
+     return rawData;
+   }
+
+/**************************************************************************/
+/*
+    transferInTransaction()
+
+    Reads raw data from MAX6675, caller has already called
+    SPI.beginTransaction() with getSettings(), see MAX6675SPIBus
+*/
+/**************************************************************************/
+   uint16_t transferInTransaction(void)
+   {
+     uint16_t rawData = 0;
+
+     digitalWrite(_cs, LOW);                                         //set software CS low to enable SPI interface for MAX6675
+
+     rawData = SPI.transfer16(0x0000);                               //chip has read only SPI & MOSI not connected, so it doesn't metter what to send
+
+     digitalWrite(_cs, HIGH);                                        //disables SPI interface for MAX6675, but it will initiate measurement/conversion
+
+     return rawData;
+   }
+
+/**************************************************************************/
+/*
+    getSettings()
+
+    Returns SPI settings shared by all sensors, computed once
+*/
+/**************************************************************************/
+   static const SPISettings &getSettings(void)
+   {
+     static const SPISettings settings(MAX6675_SPI_CLOCK, MSBFIRST, SPI_MODE0);
+
+     return settings;
+   }
+
+  private:
+   uint8_t _cs;
+};
+
+
+/*
+   Pins for MAX6675SoftSPI, numbers are known at run time only
+*/
+class MAX6675DigitalPins
+{
+  public:
+/**************************************************************************/
+/*
+    MAX6675DigitalPins()
+
+    Constructor for run time pins
+
+    NOTE:
+    - on AVR port registers & bitmasks are looked up once here, so
+      bit-bang doesn't search pin mapping tables on every edge, lookup
+      reads PROGMEM tables only & is safe before setup()
+*/
+/**************************************************************************/
+   MAX6675DigitalPins(uint8_t cs, uint8_t so, uint8_t sck) : _cs(cs), _so(so), _sck(sck)
+   {
+     #if defined(MAX6675_SOFT_FAST_GPIO)
+     _csPort  = portOutputRegister(digitalPinToPort(cs));
+     _csMask  = digitalPinToBitMask(cs);
+     _soPin   = portInputRegister(digitalPinToPort(so));
+     _soMask  = digitalPinToBitMask(so);
+     _sckPort = portOutputRegister(digitalPinToPort(sck));
+     _sckMask = digitalPinToBitMask(sck);
+     #endif
+   }
+
+   void beginPins(void) {pinMode(_cs, OUTPUT); pinMode(_so, INPUT); pinMode(_sck, OUTPUT);}
+
+/**************************************************************************/
+/*
+    writeCS(), writeSCK(), readSO()
+
+    Set & read pin state
+
+    NOTE:
+    - on AVR writes to the cached port register, read-modify-write
+      of the port is done with interrupts disabled same as digitalWrite()
+*/
+/**************************************************************************/
+   #if defined(MAX6675_SOFT_FAST_GPIO)
+   void writeCS(uint8_t value)  {_writePort(_csPort, _csMask, value);}
+   void writeSCK(uint8_t value) {_writePort(_sckPort, _sckMask, value);}
+   uint8_t readSO(void)         {return ((*_soPin & _soMask) != 0);}
+   #else
+   void writeCS(uint8_t value)  {digitalWrite(_cs, value);}
+   void writeSCK(uint8_t value) {digitalWrite(_sck, value);}
+   uint8_t readSO(void)         {return digitalRead(_so);}
+   #endif
+
+  private:
+   uint8_t _cs;
+   uint8_t _so;
+   uint8_t _sck;
+
+   #if defined(MAX6675_SOFT_FAST_GPIO)
+   volatile uint8_t *_csPort;
+   volatile uint8_t *_soPin;
+   volatile uint8_t *_sckPort;
+            uint8_t  _csMask;
+            uint8_t  _soMask;
+            uint8_t  _sckMask;
+
+   static void _writePort(volatile uint8_t *port, uint8_t mask, uint8_t value)
+   {
+     uint8_t oldSREG = SREG;
+
+     cli();
+
+     if (value == LOW) *port &= ~mask;
+     else              *port |=  mask;
+
+     SREG = oldSREG;
+   }
+   #endif
+};
+
+
+/*
+   Pins for MAX6675SoftSPI, numbers are resolved at compile time, see MAX6675FastPin
+*/
+template <uint8_t CS, uint8_t SO, uint8_t SCK>
+class MAX6675FastPins
+{
+  public:
+   void    beginPins(void) {pinMode(CS, OUTPUT); pinMode(SO, INPUT); pinMode(SCK, OUTPUT);}
+   void    writeCS(uint8_t value)  {MAX6675FastPin<CS>::write(value);}
+   void    writeSCK(uint8_t value) {MAX6675FastPin<SCK>::write(value);}
+   uint8_t readSO(void)            {return MAX6675FastPin<SO>::read();}
+};
+
+
+template <class PINS, uint8_t SCK_DELAY = MAX6675_SOFT_SCK_DELAY>
+class MAX6675SoftSPI : public PINS
+{
+  public:
+   using PINS::PINS;
+
+   void begin(void)
+   {
+     PINS::beginPins();
+
+     PINS::writeCS(HIGH);                        //disables SPI interface for MAX6675, but it will initiate measurement/conversion
+     PINS::writeSCK(LOW);
+   }
+
+   void pulseCS(void)
+   {
+     PINS::writeCS(LOW);                         //stop  measurement/conversion
+     delayMicroseconds(1);
+     PINS::writeCS(HIGH);                        //start measurement/conversion
+   }
+
+/**************************************************************************/
+/*
+    transfer()
+
+    Reads raw data from MAX6675 via software/bit-bang SPI
+
+    NOTE:
+    - set CS low to enable the serial interface & force to output the first bit on the SO pin,
+      apply 16 clock signals at SCK to read the results at SO on the falling edge of the SCK
+    - see MAX6675::decodeRawData() for data format
+    - max SPI master clock speed is equal with board speed
+      (16000000UL for 5V 16MHz/ProMini), but MAX6675 max speed is only 4.3MHz,
+      see MAX6675_SOFT_SCK_DELAY
+    - SPI_MODE0 -> data available shortly after the rising edge of SCK
+    - irqOffTime, if not null, accumulates time with interrupts disabled
+      in microseconds, see MAX6675_DISABLE_INTERRUPTS & MAX6675Stats
+*/
+/**************************************************************************/
+   uint16_t transfer(uint32_t *irqOffTime = 0)
+   {
+     uint16_t rawData = 0;
+
+     PINS::writeCS(LOW);                         //set CS low to enable SPI interface for MAX6675
+
+     #ifdef MAX6675_DISABLE_INTERRUPTS
+     uint32_t irqOffStart = (irqOffTime != 0) ? micros() : 0;
+
+     noInterrupts();                             //disable all interrupts for critical operations below
+     #endif
+
+     /* emulate SPI_MODE0 */
+     for (int8_t i = 16; i > 0; i--)             //read 16-bits in order MSB->LSB (D15..D0 bit)
+     {
+       PINS::writeSCK(HIGH);                     //data available shortly after rising edge of SCK
+
+       if (SCK_DELAY > 0) delayMicroseconds(SCK_DELAY);
+
+       rawData = (rawData << 1) | PINS::readSO();
+       PINS::writeSCK(LOW);                      //data is clocked out on falling edge of SCK
+
+       if (SCK_DELAY > 0) delayMicroseconds(SCK_DELAY);
+     }
+
+     #ifdef MAX6675_DISABLE_INTERRUPTS
+     interrupts();                               //re-enable all interrupts
+
+     if (irqOffTime != 0) *irqOffTime += micros() - irqOffStart;
+     #else
+     (void)irqOffTime;
+     #endif
+
+     PINS::writeCS(HIGH);                        //disables SPI interface for MAX6675, but it will initiate measurement/conversion
+
+     return rawData;
+   }
+};
+
+#endif